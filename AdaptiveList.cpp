@@ -0,0 +1,482 @@
+// Program Information //////////////////////////////////////////////////////////
+/**
+ * @file AdaptiveList.cpp
+ *
+ * @brief Implementation file for the adaptive list
+ *
+ * @details Implements all functions and methods defined by the AdaptiveList
+ *          class. getEntry, replace, insert and remove are charged their cost
+ *          in both representations, measured in entries touched. The chain
+ *          costs the walk to the position, including appends, since
+ *          LinkedList keeps no tail pointer; the array costs one access plus
+ *          the entries an insert or removal shifts. traverse costs the same
+ *          in both and is not counted
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives /////////////////////////////////////////////////////
+#ifndef ADAPTIVE_LIST_CPP
+#define ADAPTIVE_LIST_CPP
+
+// Header Files ////////////////////////////////////////////////////////////////
+#include "PrecondViolatedExcep.h"
+#include "AdaptiveList.h"
+
+// Class/Data Structure member implementations /////////////////////////////////
+template<class ItemType>
+const int AdaptiveList<ItemType> :: WINDOW_SIZE;
+
+template<class ItemType>
+const int AdaptiveList<ItemType> :: MIGRATE_COST_RATIO;
+
+template<class ItemType>
+const int AdaptiveList<ItemType> :: WINDOWS_TO_MIGRATE;
+
+/**
+ * @brief Adaptive list default constructor
+ *
+ * @details New lists start array backed, which suits the common fill then
+ *          read pattern
+ *
+ * @pre none
+ *
+ * @post Initialized empty array backed list with an empty observation window
+ *
+ * @par none
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+AdaptiveList<ItemType> :: AdaptiveList()
+	: arrayBacked(true), windowOperations(0), windowArrayCost(0), windowChainCost(0),
+	  migrationVotes(0), migrationCount(0)
+{
+}
+
+/**
+ * @brief Destructor for the adaptive list class
+ *
+ * @details The array and the chain release their own entries
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+AdaptiveList<ItemType> :: ~AdaptiveList()
+{
+}
+
+/**
+ * @brief Checks if the list is empty
+ *
+ * @return a boolean for an empty list
+ *
+ */
+template<class ItemType>
+bool AdaptiveList<ItemType> :: isEmpty() const
+{
+	return getLength() == 0;
+}
+
+/**
+ * @brief Gets the length of the list
+ *
+ * @return the number of items in the list
+ *
+ */
+template<class ItemType>
+int AdaptiveList<ItemType> :: getLength() const
+{
+	return arrayBacked ? static_cast<int>(array.size()) : chain.getLength();
+}
+
+/**
+ * @brief Inserts an entry at some position
+ *
+ * @details Charged the walk to newPosition for the chain and the entries
+ *          from newPosition on for the array
+ *
+ * @pre none
+ *
+ * @post If 1 <= newPosition <= getLength() + 1, newEntry is at that position
+ *       and later entries are renumbered
+ *
+ * @par Algorithm
+ *      Inserts into the representation in use, then records the operation
+ *
+ * @param[in] newPosition is where the entry will be inserted in this list
+ *
+ * @param[in] newEntry is the item to be inserted into the list
+ *
+ * @return a boolean logic if the insertion could be done or not
+ *
+ */
+template<class ItemType>
+bool AdaptiveList<ItemType> :: insert(int newPosition, const ItemType& newEntry)
+{
+	int tailPosition = getLength() + 1;
+	bool ableToInsert = (newPosition >= 1) && (newPosition <= tailPosition);
+
+	if (ableToInsert)
+	{
+		if (arrayBacked)
+		{
+			array.insert(array.begin() + (newPosition - 1), newEntry);
+		}
+
+		else
+		{
+			chain.insert(newPosition, newEntry);
+		}
+
+		recordOperation(newPosition, tailPosition - newPosition);
+	}
+
+	return ableToInsert;
+}
+
+/**
+ * @brief Removes the entry at some position
+ *
+ * @details Charged the walk to position for the chain and the entries
+ *          after position for the array
+ *
+ * @pre none
+ *
+ * @post If 1 <= position <= getLength(), the entry at that position is removed
+ *       and later entries are renumbered
+ *
+ * @par Algorithm
+ *      Removes from the representation in use, then records the operation
+ *
+ * @param[in] position is where the entry will be removed from
+ *
+ * @return A booleon for successful removal or not
+ *
+ */
+template<class ItemType>
+bool AdaptiveList<ItemType> :: remove(int position)
+{
+	int tailPosition = getLength();
+	bool ableToRemove = (position >= 1) && (position <= tailPosition);
+
+	if (ableToRemove)
+	{
+		if (arrayBacked)
+		{
+			array.erase(array.begin() + (position - 1));
+		}
+
+		else
+		{
+			chain.remove(position);
+		}
+
+		recordOperation(position, tailPosition - position);
+	}
+
+	return ableToRemove;
+}
+
+/**
+ * @brief Clears the list
+ *
+ * @details Keeps the representation and the observations
+ *
+ * @pre none
+ *
+ * @post the list is empty
+ *
+ * @par none
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void AdaptiveList<ItemType> :: clear()
+{
+	array.clear();
+	chain.clear();
+}
+
+/**
+ * @brief Gets the entry at some position entered by user
+ *
+ * @details Charged the walk to position for the chain and one access for
+ *          the array
+ *
+ * @pre none
+ *
+ * @post Returns the data or throws an exception for an invalid position
+ *
+ * @par Algorithm
+ *      Records the read, which may migrate the list, then reads the entry
+ *      from the representation in use
+ *
+ * @exception PrecondViolatedExcep if the position is outside the list
+ *
+ * @param[in] position is where the method will attempt to retrieve the data
+ *
+ * @return a copy of the data at the position
+ *
+ */
+template<class ItemType>
+ItemType AdaptiveList<ItemType> :: getEntry(int position) const
+{
+	bool ableToGet = (position >= 1) && (position <= getLength());
+
+	if (!ableToGet)
+	{
+		throw(PrecondViolatedExcept("getEntry() called with an empty list or invalid position."));
+	}
+
+	recordOperation(position, 0);
+	return arrayBacked ? array[position - 1] : chain[position];
+}
+
+/**
+ * @brief Replaces the entry at some position
+ *
+ * @details Charged like getEntry(), since it costs the same lookup
+ *
+ * @pre none
+ *
+ * @post The entry at the given position is newEntry
+ *
+ * @par Algorithm
+ *      Records the read, which may migrate the list, then sets the entry in
+ *      the representation in use
+ *
+ * @exception PrecondViolatedExcep if the position is outside the list
+ *
+ * @param[in] position is the location in the list for where the item is to be replaced
+ *
+ * @param[in] newEntry is the replacement item
+ *
+ * @return the entry now at the position, as LinkedList::replace() does
+ *
+ */
+template<class ItemType>
+ItemType AdaptiveList<ItemType> :: replace(int position, const ItemType& newEntry)
+{
+	bool ableToSet = (position >= 1) && (position <= getLength());
+
+	if (!ableToSet)
+	{
+		throw(PrecondViolatedExcept("replace() called with an empty list or invalid position."));
+	}
+
+	recordOperation(position, 0);
+	ItemType& entry = arrayBacked ? array[position - 1] : chain[position];
+	entry = newEntry;
+	return entry;
+}
+
+/**
+ * @brief Visits the entries of the list in order in a single pass
+ *
+ * @details See LinkedList::traverse(). Not counted as positional reads
+ *
+ * @pre visit can be called as bool(const ItemType&)
+ *
+ * @post visit has been called on each entry until it returned false
+ *
+ * @par none
+ *
+ * @param[in] visit is called with each entry and returns false to stop early
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+template<class Visitor>
+void AdaptiveList<ItemType> :: traverse(Visitor visit) const
+{
+	if (arrayBacked)
+	{
+		for (typename std::vector<ItemType>::size_type index = 0;
+		     index < array.size() && visit(static_cast<const ItemType&>(array[index]));
+		     index++)
+		{
+		}
+	}
+
+	else
+	{
+		chain.traverse(visit);
+	}
+}
+
+/**
+ * @brief Tells which representation is in use
+ *
+ * @return true when array backed, false when backed by a LinkedList
+ *
+ */
+template<class ItemType>
+bool AdaptiveList<ItemType> :: isArrayBacked() const
+{
+	return arrayBacked;
+}
+
+/**
+ * @brief Gets the number of times the list has migrated
+ *
+ * @return the number of migrations in either direction
+ *
+ */
+template<class ItemType>
+int AdaptiveList<ItemType> :: getMigrationCount() const
+{
+	return migrationCount;
+}
+
+/**
+ * @brief Charges one operation to the current window
+ *
+ * @details The chain reaches a position by walking from the head, so it is
+ *          charged the position. The array is charged one access plus the
+ *          entries it shifts
+ *
+ * @pre none
+ *
+ * @post the costs are added, and the window is closed if it is full
+ *
+ * @par none
+ *
+ * @param[in] position is the position the operation used
+ *
+ * @param[in] shiftedEntries is how many entries an array insert or removal
+ *            at that position moves, 0 for a read
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void AdaptiveList<ItemType> :: recordOperation(int position, int shiftedEntries) const
+{
+	windowOperations++;
+	windowArrayCost += 1 + shiftedEntries;
+	windowChainCost += position;
+
+	if (windowOperations >= WINDOW_SIZE)
+	{
+		endWindow();
+	}
+}
+
+/**
+ * @brief Closes an observation window and migrates if the votes agree
+ *
+ * @details Requiring a clear margin and a saving larger than the copy keeps
+ *          a workload that costs about the same either way, or a short list,
+ *          in the current representation
+ *
+ * @pre none
+ *
+ * @post the window costs are reset; the list may have migrated
+ *
+ * @par Algorithm
+ *      A window votes to switch when the other representation would have
+ *      cost at most 1 / MIGRATE_COST_RATIO as much, and the saving is more
+ *      than the getLength() entries a migration copies. A window that does
+ *      not vote resets the votes. After WINDOWS_TO_MIGRATE consecutive votes
+ *      the list migrates
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void AdaptiveList<ItemType> :: endWindow() const
+{
+	long long currentCost = arrayBacked ? windowArrayCost : windowChainCost;
+	long long otherCost = arrayBacked ? windowChainCost : windowArrayCost;
+	bool voteToSwitch = (otherCost * MIGRATE_COST_RATIO <= currentCost)
+	                    && (currentCost - otherCost > getLength());
+
+	windowOperations = 0;
+	windowArrayCost = 0;
+	windowChainCost = 0;
+	migrationVotes = voteToSwitch ? migrationVotes + 1 : 0;
+
+	if (migrationVotes >= WINDOWS_TO_MIGRATE)
+	{
+		migrationVotes = 0;
+
+		if (arrayBacked)
+		{
+			migrateToLinked();
+		}
+
+		else
+		{
+			migrateToArray();
+		}
+	}
+}
+
+/**
+ * @brief Moves the entries from the linked chain into the array
+ *
+ * @details If copying an entry throws, the list is left backed by the
+ *          chain and unchanged
+ *
+ * @pre the list is backed by the chain
+ *
+ * @post the list is array backed and the chain is empty
+ *
+ * @par Algorithm
+ *      Copies the chain into a new vector in one traversal, then swaps it
+ *      into the array and clears the chain
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void AdaptiveList<ItemType> :: migrateToArray() const
+{
+	std::vector<ItemType> entries;
+
+	entries.reserve(chain.getLength());
+	chain.traverse([&entries](const ItemType& entry) -> bool
+	{
+		entries.push_back(entry);
+		return true;
+	});
+
+	array.swap(entries);
+	chain.clear();
+
+	arrayBacked = true;
+	migrationCount++;
+}
+
+/**
+ * @brief Moves the entries from the array into the linked chain
+ *
+ * @details insertRange() leaves the chain untouched if copying an entry
+ *          throws, so the list then stays array backed and unchanged
+ *
+ * @pre the list is array backed
+ *
+ * @post the list is backed by the chain and the array holds no memory
+ *
+ * @par Algorithm
+ *      Builds the chain with one insertRange(), then releases the array
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void AdaptiveList<ItemType> :: migrateToLinked() const
+{
+	chain.insertRange(1, array.begin(), array.end());
+	std::vector<ItemType>().swap(array);
+
+	arrayBacked = false;
+	migrationCount++;
+}
+
+#endif // end ADAPTIVE_LIST_CPP
@@ -0,0 +1,89 @@
+// Program Information /////////////////////////////////////////////////////
+/**
+ * @file AdaptiveList.h
+ *
+ * @brief Header file for the adaptive list
+ *
+ * @details List that switches between a contiguous array and a LinkedList
+ *          based on the operations it observes. Each operation is charged
+ *          what it would cost in both representations: the chain walks to
+ *          the position, the array shifts the entries after it. The costs
+ *          are summed over fixed windows of operations and the list only
+ *          migrates after several windows in a row find the other
+ *          representation clearly cheaper, so it does not flip back and
+ *          forth on a mixed workload.
+ *
+ *          A const read may migrate the representation, so unlike LinkedList
+ *          concurrent readers need external synchronization
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives ////////////////////////////////////////////////
+#ifndef ADAPTIVE_LIST_H
+#define ADAPTIVE_LIST_H
+
+// Header Files ///////////////////////////////////////////////////////////
+#include <vector>
+#include "ListInterface.h"
+#include "StaticListInterface.h"
+#include "LinkedList.h"
+#include "PrecondViolatedExcep.h"
+
+// Adaptive List Templated Class Definition ///////////////////////////////
+template<class ItemType>
+class AdaptiveList : public ListInterface<ItemType>,
+                     public StaticListInterface<AdaptiveList<ItemType>, ItemType> {
+public:
+	AdaptiveList();
+	virtual ~AdaptiveList();
+
+	// functions for the list
+	bool isEmpty() const;
+	int getLength() const;
+	bool insert(int newPosition, const ItemType& newEntry);
+	bool remove(int position);
+	void clear();
+
+	// ItemType functions
+	ItemType getEntry(int position) const;
+	ItemType replace(int position, const ItemType& newEntry);
+
+	// visits every entry in order in a single pass
+	template<class Visitor>
+	void traverse(Visitor visit) const;
+
+	// representation in use
+	bool isArrayBacked() const;
+	int getMigrationCount() const;
+
+private:
+	// operations per observation window
+	static const int WINDOW_SIZE = 256;
+	// how many times cheaper the other representation must be to get a vote
+	static const int MIGRATE_COST_RATIO = 2;
+	// consecutive votes needed before migrating
+	static const int WINDOWS_TO_MIGRATE = 2;
+
+	// a const read may migrate, which does not change the entries
+	mutable std::vector<ItemType> array;
+	mutable LinkedList<ItemType> chain;
+	mutable bool arrayBacked;
+	mutable int windowOperations;
+	mutable long long windowArrayCost;
+	mutable long long windowChainCost;
+	mutable int migrationVotes;
+	mutable int migrationCount;
+
+	void recordOperation(int position, int shiftedEntries) const;
+	void endWindow() const;
+	void migrateToArray() const;
+	void migrateToLinked() const;
+
+	// copying would also copy the observation window, so it is not allowed
+	AdaptiveList(const AdaptiveList<ItemType>& otherList) = delete;
+	AdaptiveList<ItemType>& operator=(const AdaptiveList<ItemType>& otherList) = delete;
+};
+
+#include "AdaptiveList.cpp"
+#endif // end ADAPTIVE_LIST_H
@@ -0,0 +1,263 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file AdaptiveListBenchmark.cpp
+ *
+ * @brief Compares the adaptive list with the fixed lists on mixed traces
+ *
+ * @details Captures a handful of workloads with TracingList, then replays
+ *          each trace with replayTrace() against an AdaptiveList, a
+ *          LinkedList and a PooledList and prints the elapsed time, the
+ *          throughput and the latency percentiles of every replay, along with
+ *          how often the adaptive list migrated. Every workload starts by
+ *          appending LIST_LENGTH entries to an empty list
+ *
+ * @version 1.00
+ */
+
+// Header Files ////////////////////////////////////////////////////////////////
+#include "AdaptiveList.h"
+#include "LinkedList.h"
+#include "PooledList.h"
+#include "TracingList.h"
+#include "TraceReplay.h"
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+
+// Benchmark constants /////////////////////////////////////////////////////////
+static const int LIST_LENGTH = 20000;
+static const int WORKLOAD_OPS = 20000;
+static const int PHASE_OPS = 5000;
+
+// Workload functions //////////////////////////////////////////////////////////
+/**
+ * @brief Fills the list by appending, as every workload starts
+ *
+ * @param[in] list is the traced list to fill
+ *
+ * @return none
+ *
+ */
+static void appendEntries(ListInterface<int>& list)
+{
+	for (int entry = 1; entry <= LIST_LENGTH; entry++)
+	{
+		list.insert(list.getLength() + 1, entry);
+	}
+}
+
+/**
+ * @brief Reads entries at random positions
+ *
+ * @param[in] list is the traced list
+ *
+ * @param[in] random is the generator to draw positions from
+ *
+ * @param[in] count is how many entries to read
+ *
+ * @return none
+ *
+ */
+static void readRandomly(ListInterface<int>& list, std::mt19937& random, int count)
+{
+	for (int op = 0; op < count; op++)
+	{
+		std::uniform_int_distribution<int> position(1, list.getLength());
+		list.getEntry(position(random));
+	}
+}
+
+/**
+ * @brief Inserts and removes entries near the head, as a stack or queue would
+ *
+ * @param[in] list is the traced list
+ *
+ * @param[in] count is how many insert and remove pairs to make
+ *
+ * @return none
+ *
+ */
+static void editNearHead(ListInterface<int>& list, int count)
+{
+	for (int op = 0; op < count; op++)
+	{
+		list.insert(1 + op % 4, op);
+		list.remove(1 + (op + 2) % 4);
+	}
+}
+
+/**
+ * @brief Inserts and removes entries just before the tail
+ *
+ * @param[in] list is the traced list
+ *
+ * @param[in] count is how many insert and remove pairs to make
+ *
+ * @return none
+ *
+ */
+static void editNearTail(ListInterface<int>& list, int count)
+{
+	for (int op = 0; op < count; op++)
+	{
+		list.insert(list.getLength(), op);
+		list.remove(list.getLength() - 1);
+	}
+}
+
+/**
+ * @brief Mixes reads, replaces, inserts and removals at random positions
+ *
+ * @param[in] list is the traced list
+ *
+ * @param[in] random is the generator to draw positions and operations from
+ *
+ * @param[in] count is how many operations to make
+ *
+ * @return none
+ *
+ */
+static void mixRandomly(ListInterface<int>& list, std::mt19937& random, int count)
+{
+	std::uniform_int_distribution<int> operation(0, 3);
+
+	for (int op = 0; op < count; op++)
+	{
+		std::uniform_int_distribution<int> position(1, list.getLength());
+
+		switch (operation(random))
+		{
+			case 0:
+				list.getEntry(position(random));
+				break;
+
+			case 1:
+				list.replace(position(random), op);
+				break;
+
+			case 2:
+				list.insert(position(random), op);
+				break;
+
+			default:
+				list.remove(position(random));
+				break;
+		}
+	}
+}
+
+/**
+ * @brief Captures one named workload into a trace
+ *
+ * @details The workload is run against an AdaptiveList through TracingList;
+ *          the trace only depends on the operations, not on the list
+ *
+ * @param[in] workload is the name of the workload to capture
+ *
+ * @param[out] trace receives the records
+ *
+ * @return none
+ *
+ */
+static void captureWorkload(const std::string& workload, ListTrace& trace)
+{
+	AdaptiveList<int> capturedList;
+	TracingList<int> tracingList(capturedList, trace);
+	std::mt19937 random(2024);
+
+	appendEntries(tracingList);
+
+	if (workload == "random reads")
+	{
+		readRandomly(tracingList, random, WORKLOAD_OPS);
+	}
+
+	else if (workload == "head edits")
+	{
+		editNearHead(tracingList, WORKLOAD_OPS / 2);
+	}
+
+	else if (workload == "near-tail edits")
+	{
+		editNearTail(tracingList, WORKLOAD_OPS / 2);
+	}
+
+	else if (workload == "random mix")
+	{
+		mixRandomly(tracingList, random, WORKLOAD_OPS);
+	}
+
+	else
+	{
+		// alternating phases of head edits and random reads
+		for (int phase = 0; phase < WORKLOAD_OPS / PHASE_OPS; phase++)
+		{
+			if (phase % 2 == 0)
+			{
+				editNearHead(tracingList, PHASE_OPS / 2);
+			}
+
+			else
+			{
+				readRandomly(tracingList, random, PHASE_OPS);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Prints one replay as a table row
+ *
+ * @param[in] listName is the name of the list that was replayed against
+ *
+ * @param[in] report is the report of the replay
+ *
+ * @param[in] note is extra text for the end of the row
+ *
+ * @return none
+ *
+ */
+static void printRow(const std::string& listName, const ReplayReport& report, const std::string& note)
+{
+	std::cout << "  " << std::left << std::setw(14) << listName << std::right
+	          << std::setw(10) << std::fixed << std::setprecision(1)
+	          << report.getElapsedNanoseconds() / 1e6 << " ms"
+	          << std::setw(14) << static_cast<long>(report.getThroughput()) << " ops/s"
+	          << "  p50 " << std::setw(7) << report.getLatencyPercentile(50.0) << " ns"
+	          << "  p99 " << std::setw(8) << report.getLatencyPercentile(99.0) << " ns"
+	          << "  " << note << std::endl;
+}
+
+// Main program ////////////////////////////////////////////////////////////////
+int main()
+{
+	const std::string workloads[] = { "random reads", "head edits", "near-tail edits",
+	                                  "random mix", "phased" };
+	const int workloadCount = sizeof(workloads) / sizeof(workloads[0]);
+
+	std::cout << LIST_LENGTH << " appends, then " << WORKLOAD_OPS
+	          << " operations per workload" << std::endl;
+
+	for (int workload = 0; workload < workloadCount; workload++)
+	{
+		ListTrace trace;
+		captureWorkload(workloads[workload], trace);
+
+		AdaptiveList<int> adaptiveList;
+		LinkedList<int> linkedList;
+		PooledList<int> pooledList;
+
+		std::cout << workloads[workload] << " (" << trace.getLength() << " records)" << std::endl;
+
+		ReplayReport adaptiveReport = replayTrace(trace, adaptiveList);
+		printRow("AdaptiveList", adaptiveReport,
+		         std::to_string(adaptiveList.getMigrationCount()) + " migrations, ends "
+		         + (adaptiveList.isArrayBacked() ? "array backed" : "linked"));
+
+		printRow("LinkedList", replayTrace(trace, linkedList), "");
+		printRow("PooledList", replayTrace(trace, pooledList), "");
+	}
+
+	return 0;
+}
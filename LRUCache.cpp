@@ -0,0 +1,611 @@
+// Program Information //////////////////////////////////////////////////////////
+/**
+ * @file LRUCache.cpp
+ *
+ * @brief Implementation file for the least recently used cache
+ *
+ * @details Implements all functions and methods defined by the LRUCache class
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives /////////////////////////////////////////////////////
+#ifndef LRU_CACHE_CPP
+#define LRU_CACHE_CPP
+
+// Header Files ////////////////////////////////////////////////////////////////
+#include "LRUCache.h"
+
+// Class/Data Structure member implementations /////////////////////////////////
+/**
+ * @brief LRU cache constructor
+ *
+ * @details Creates an empty cache with the given bounds
+ *
+ * @pre none
+ *
+ * @post Initialized empty cache with null head and tail pointers and zeroed counters
+ *
+ * @par Algorithm
+ *      Initializes all data members with the initializers
+ *
+ * @param[in] entryLimit is the most entries the cache holds, 0 for no limit
+ *
+ * @param[in] byteLimit is the most bytes the cache holds, 0 for no limit
+ *
+ * @return none
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+LRUCache<KeyType, ValueType, Hash> :: LRUCache(int entryLimit, std::size_t byteLimit)
+	: headPtr(nullptr), tailPtr(nullptr), maxEntries(entryLimit), maxBytes(byteLimit),
+	  bytesUsed(0), hitCount(0), missCount(0), evictionCount(0)
+{
+}
+
+/**
+ * @brief Destructor for the LRU cache class
+ *
+ * @details Deletes all entries when it is out of scope
+ *
+ * @pre none
+ *
+ * @post All entries are deallocated
+ *
+ * @par Algorithm
+ *      Uses the function clear() to delete entries
+ *
+ * @return none
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+LRUCache<KeyType, ValueType, Hash> :: ~LRUCache()
+{
+	clear();
+}
+
+/**
+ * @brief Checks if the cache is empty
+ *
+ * @details none
+ *
+ * @pre none
+ *
+ * @post determines if the cache holds no entries
+ *
+ * @par none
+ *
+ * @return a boolean for an empty cache
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+bool LRUCache<KeyType, ValueType, Hash> :: isEmpty() const
+{
+	return index.empty();
+}
+
+/**
+ * @brief Gets the number of entries in the cache
+ *
+ * @details none
+ *
+ * @pre none
+ *
+ * @post determines the number of entries in the cache
+ *
+ * @par none
+ *
+ * @return the number of entries as an int
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+int LRUCache<KeyType, ValueType, Hash> :: getLength() const
+{
+	return static_cast<int>(index.size());
+}
+
+/**
+ * @brief Checks if a key is cached without touching it
+ *
+ * @details Does not change the recency order or the hit and miss counters
+ *
+ * @pre none
+ *
+ * @post none, the cache is not modified
+ *
+ * @par none
+ *
+ * @param[in] key is the key to look for
+ *
+ * @return a boolean for whether the key is cached
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+bool LRUCache<KeyType, ValueType, Hash> :: contains(const KeyType& key) const
+{
+	return index.find(key) != index.end();
+}
+
+/**
+ * @brief Gets the value cached for a key and marks it most recently used
+ *
+ * @details Counts a hit or a miss
+ *
+ * @pre none
+ *
+ * @post If the key is cached, value holds a copy of its value and the entry
+ *       is the most recently used one; otherwise value is left untouched
+ *
+ * @par Algorithm
+ *      Looks the entry up in the hash index and moves it to the front of the
+ *      recency chain, all in O(1)
+ *
+ * @param[in] key is the key to look for
+ *
+ * @param[out] value receives the cached value
+ *
+ * @return a boolean for a hit or a miss
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+bool LRUCache<KeyType, ValueType, Hash> :: get(const KeyType& key, ValueType& value)
+{
+	typename std::unordered_map<KeyType, CacheEntry*, Hash>::iterator found = index.find(key);
+
+	if (found == index.end())
+	{
+		missCount++;
+		return false;
+	}
+
+	hitCount++;
+	CacheEntry* entryPtr = found->second;
+	unlinkEntry(entryPtr);
+	linkAtFront(entryPtr);
+	value = entryPtr->value;
+
+	return true;
+}
+
+/**
+ * @brief Caches a value for a key, charging its static size
+ *
+ * @details The entry is charged sizeof(KeyType) + sizeof(ValueType) bytes;
+ *          use the three argument put() for types that own heap memory
+ *
+ * @pre none
+ *
+ * @post see the three argument put()
+ *
+ * @par Algorithm
+ *      Forwards to the three argument put()
+ *
+ * @param[in] key is the key to cache under
+ *
+ * @param[in] value is the value to cache
+ *
+ * @return a boolean for whether the value was cached
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+bool LRUCache<KeyType, ValueType, Hash> :: put(const KeyType& key, const ValueType& value)
+{
+	return put(key, value, sizeof(KeyType) + sizeof(ValueType));
+}
+
+/**
+ * @brief Caches a value for a key and marks it most recently used
+ *
+ * @details Replaces the value if the key is already cached. Least recently
+ *          used entries are evicted until the cache is within its bounds
+ *
+ * @pre none
+ *
+ * @post If the entry fits, it is cached as the most recently used entry and
+ *       the cache is within its bounds; otherwise the cache is unchanged
+ *
+ * @par Algorithm
+ *      Updates the existing entry or creates a new one, links it at the front
+ *      of the recency chain and evicts from the back while over a bound
+ *
+ * @exception none; if allocation fails the cache is left unchanged
+ *
+ * @param[in] key is the key to cache under
+ *
+ * @param[in] value is the value to cache
+ *
+ * @param[in] bytes is what the entry is charged against the byte bound
+ *
+ * @return false if the entry alone is larger than the byte bound, otherwise true
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+bool LRUCache<KeyType, ValueType, Hash> :: put(const KeyType& key, const ValueType& value, std::size_t bytes)
+{
+	bool ableToPut = (maxBytes == 0) || (bytes <= maxBytes);
+
+	if (ableToPut)
+	{
+		typename std::unordered_map<KeyType, CacheEntry*, Hash>::iterator found = index.find(key);
+		CacheEntry* entryPtr = nullptr;
+
+		if (found != index.end())
+		{
+			// update the existing entry
+			entryPtr = found->second;
+			entryPtr->value = value;
+			bytesUsed = bytesUsed - entryPtr->bytes + bytes;
+			entryPtr->bytes = bytes;
+			unlinkEntry(entryPtr);
+		}
+
+		else
+		{
+			// create a new entry and index it
+			entryPtr = new CacheEntry{key, value, bytes, nullptr, nullptr};
+
+			try
+			{
+				index.insert(std::make_pair(key, entryPtr));
+			}
+
+			catch (...)
+			{
+				delete entryPtr;
+				throw;
+			}
+
+			bytesUsed += bytes;
+		}
+
+		linkAtFront(entryPtr);
+		evictToFit();
+	}
+
+	return ableToPut;
+}
+
+/**
+ * @brief Marks a cached key as the most recently used one
+ *
+ * @details Counts a hit or a miss, like get() but without copying the value
+ *
+ * @pre none
+ *
+ * @post If the key is cached, its entry is at the front of the recency chain
+ *
+ * @par Algorithm
+ *      Looks the entry up in the hash index and moves it to the front, in O(1)
+ *
+ * @param[in] key is the key to touch
+ *
+ * @return a boolean for a hit or a miss
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+bool LRUCache<KeyType, ValueType, Hash> :: touch(const KeyType& key)
+{
+	typename std::unordered_map<KeyType, CacheEntry*, Hash>::iterator found = index.find(key);
+
+	if (found == index.end())
+	{
+		missCount++;
+		return false;
+	}
+
+	hitCount++;
+	unlinkEntry(found->second);
+	linkAtFront(found->second);
+
+	return true;
+}
+
+/**
+ * @brief Removes a key from the cache
+ *
+ * @details Not counted as an eviction
+ *
+ * @pre none
+ *
+ * @post The key is no longer cached
+ *
+ * @par Algorithm
+ *      Looks the entry up in the hash index, unlinks and deletes it
+ *
+ * @param[in] key is the key to remove
+ *
+ * @return a boolean for whether the key was cached
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+bool LRUCache<KeyType, ValueType, Hash> :: remove(const KeyType& key)
+{
+	typename std::unordered_map<KeyType, CacheEntry*, Hash>::iterator found = index.find(key);
+	bool ableToRemove = (found != index.end());
+
+	if (ableToRemove)
+	{
+		eraseEntry(found->second);
+	}
+
+	return ableToRemove;
+}
+
+/**
+ * @brief Evicts the least recently used entry
+ *
+ * @details Counted as an eviction
+ *
+ * @pre none
+ *
+ * @post The entry at the back of the recency chain is deleted
+ *
+ * @par Algorithm
+ *      Deletes the entry at the tail pointer, in O(1)
+ *
+ * @return a boolean for whether there was an entry to evict
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+bool LRUCache<KeyType, ValueType, Hash> :: evict()
+{
+	bool ableToEvict = (tailPtr != nullptr);
+
+	if (ableToEvict)
+	{
+		eraseEntry(tailPtr);
+		evictionCount++;
+	}
+
+	return ableToEvict;
+}
+
+/**
+ * @brief Clears the cache by deleting every entry
+ *
+ * @details The counters are kept; use resetCounters() to zero them
+ *
+ * @pre none
+ *
+ * @post the cache holds no entries and no bytes
+ *
+ * @par Algorithm
+ *      Walks the recency chain deleting each entry, then empties the index
+ *
+ * @return none
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+void LRUCache<KeyType, ValueType, Hash> :: clear()
+{
+	while (headPtr != nullptr)
+	{
+		CacheEntry* nextPtr = headPtr->next;
+		delete headPtr;
+		headPtr = nextPtr;
+	}
+
+	tailPtr = nullptr;
+	index.clear();
+	bytesUsed = 0;
+}
+
+/**
+ * @brief Gets the entry bound of the cache
+ *
+ * @return the most entries the cache holds, 0 for no limit
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+int LRUCache<KeyType, ValueType, Hash> :: getMaxEntries() const
+{
+	return maxEntries;
+}
+
+/**
+ * @brief Gets the byte bound of the cache
+ *
+ * @return the most bytes the cache holds, 0 for no limit
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+std::size_t LRUCache<KeyType, ValueType, Hash> :: getMaxBytes() const
+{
+	return maxBytes;
+}
+
+/**
+ * @brief Gets the bytes charged by the cached entries
+ *
+ * @return the sum of the bytes charged for each cached entry
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+std::size_t LRUCache<KeyType, ValueType, Hash> :: getBytesUsed() const
+{
+	return bytesUsed;
+}
+
+/**
+ * @brief Gets the number of lookups that found their key
+ *
+ * @return the hits counted by get() and touch()
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+long LRUCache<KeyType, ValueType, Hash> :: getHits() const
+{
+	return hitCount;
+}
+
+/**
+ * @brief Gets the number of lookups that did not find their key
+ *
+ * @return the misses counted by get() and touch()
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+long LRUCache<KeyType, ValueType, Hash> :: getMisses() const
+{
+	return missCount;
+}
+
+/**
+ * @brief Gets the number of entries evicted
+ *
+ * @return the evictions made by evict() and by put() to stay within bounds
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+long LRUCache<KeyType, ValueType, Hash> :: getEvictions() const
+{
+	return evictionCount;
+}
+
+/**
+ * @brief Zeroes the hit, miss and eviction counters
+ *
+ * @return none
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+void LRUCache<KeyType, ValueType, Hash> :: resetCounters()
+{
+	hitCount = 0;
+	missCount = 0;
+	evictionCount = 0;
+}
+
+/**
+ * @brief Detaches an entry from the recency chain
+ *
+ * @details The entry stays in the index
+ *
+ * @pre entryPtr is linked in the recency chain
+ *
+ * @post its neighbours point at each other and its own links are null
+ *
+ * @par Algorithm
+ *      Reconnects the previous and next entries, updating head and tail
+ *
+ * @param[in] entryPtr is the entry to detach
+ *
+ * @return none
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+void LRUCache<KeyType, ValueType, Hash> :: unlinkEntry(CacheEntry* entryPtr)
+{
+	if (entryPtr->prev == nullptr)
+	{
+		headPtr = entryPtr->next;
+	}
+
+	else
+	{
+		entryPtr->prev->next = entryPtr->next;
+	}
+
+	if (entryPtr->next == nullptr)
+	{
+		tailPtr = entryPtr->prev;
+	}
+
+	else
+	{
+		entryPtr->next->prev = entryPtr->prev;
+	}
+
+	entryPtr->prev = nullptr;
+	entryPtr->next = nullptr;
+}
+
+/**
+ * @brief Links a detached entry at the front of the recency chain
+ *
+ * @details none
+ *
+ * @pre entryPtr is not linked in the recency chain
+ *
+ * @post entryPtr is the most recently used entry
+ *
+ * @par Algorithm
+ *      Points the entry at the old head and makes it the new head
+ *
+ * @param[in] entryPtr is the entry to link
+ *
+ * @return none
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+void LRUCache<KeyType, ValueType, Hash> :: linkAtFront(CacheEntry* entryPtr)
+{
+	entryPtr->next = headPtr;
+
+	if (headPtr == nullptr)
+	{
+		tailPtr = entryPtr;
+	}
+
+	else
+	{
+		headPtr->prev = entryPtr;
+	}
+
+	headPtr = entryPtr;
+}
+
+/**
+ * @brief Unlinks, unindexes and deletes an entry
+ *
+ * @details none
+ *
+ * @pre entryPtr is a cached entry
+ *
+ * @post the entry is deleted and its bytes are released
+ *
+ * @par Algorithm
+ *      Detaches the entry from the chain and the index, then deletes it
+ *
+ * @param[in] entryPtr is the entry to delete
+ *
+ * @return none
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+void LRUCache<KeyType, ValueType, Hash> :: eraseEntry(CacheEntry* entryPtr)
+{
+	unlinkEntry(entryPtr);
+	index.erase(entryPtr->key);
+	bytesUsed -= entryPtr->bytes;
+	delete entryPtr;
+}
+
+/**
+ * @brief Evicts least recently used entries until the cache is within bounds
+ *
+ * @details The most recently used entry is never evicted, put() has already
+ *          checked that it fits on its own
+ *
+ * @pre none
+ *
+ * @post the cache is within its entry and byte bounds
+ *
+ * @par Algorithm
+ *      Evicts from the tail while either bound is exceeded
+ *
+ * @return none
+ *
+ */
+template<class KeyType, class ValueType, class Hash>
+void LRUCache<KeyType, ValueType, Hash> :: evictToFit()
+{
+	while (tailPtr != headPtr
+	       && ((maxEntries > 0 && getLength() > maxEntries)
+	           || (maxBytes > 0 && bytesUsed > maxBytes)))
+	{
+		evict();
+	}
+}
+
+#endif // end LRU_CACHE_CPP
@@ -0,0 +1,82 @@
+// Program Information /////////////////////////////////////////////////////
+/**
+ * @file LRUCache.h
+ *
+ * @brief Header file for the least recently used cache
+ *
+ * @details A hash index from key to entry combined with a doubly linked
+ *          recency chain, so that get, put, touch and evict are all O(1).
+ *          The cache can be bounded by number of entries, by bytes, or both,
+ *          and keeps hit, miss and eviction counters
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives ////////////////////////////////////////////////
+#ifndef LRU_CACHE_H
+#define LRU_CACHE_H
+
+// Header Files ///////////////////////////////////////////////////////////
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+
+// LRU Cache Templated Class Definition ///////////////////////////////////
+template<class KeyType, class ValueType, class Hash = std::hash<KeyType> >
+class LRUCache {
+public:
+	LRUCache(int entryLimit, std::size_t byteLimit = 0);
+	virtual ~LRUCache();
+
+	// functions for the cache
+	bool isEmpty() const;
+	int getLength() const;
+	bool contains(const KeyType& key) const;
+	bool get(const KeyType& key, ValueType& value);
+	bool put(const KeyType& key, const ValueType& value);
+	bool put(const KeyType& key, const ValueType& value, std::size_t bytes);
+	bool touch(const KeyType& key);
+	bool remove(const KeyType& key);
+	bool evict();
+	void clear();
+
+	// capacity and counters
+	int getMaxEntries() const;
+	std::size_t getMaxBytes() const;
+	std::size_t getBytesUsed() const;
+	long getHits() const;
+	long getMisses() const;
+	long getEvictions() const;
+	void resetCounters();
+
+private:
+	struct CacheEntry {
+		KeyType key;
+		ValueType value;
+		std::size_t bytes;
+		CacheEntry* prev;
+		CacheEntry* next;
+	};
+
+	std::unordered_map<KeyType, CacheEntry*, Hash> index;
+	CacheEntry* headPtr; // most recently used
+	CacheEntry* tailPtr; // least recently used
+	int maxEntries;
+	std::size_t maxBytes;
+	std::size_t bytesUsed;
+	long hitCount;
+	long missCount;
+	long evictionCount;
+
+	void unlinkEntry(CacheEntry* entryPtr);
+	void linkAtFront(CacheEntry* entryPtr);
+	void eraseEntry(CacheEntry* entryPtr);
+	void evictToFit();
+
+	// the chain is owned through raw pointers, so copying is not allowed
+	LRUCache(const LRUCache& otherCache) = delete;
+	LRUCache& operator=(const LRUCache& otherCache) = delete;
+};
+
+#include "LRUCache.cpp"
+#endif // end LRU_CACHE_H
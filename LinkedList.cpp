@@ -22,6 +22,8 @@
 #include "PrecondViolatedExcep.h"
 #include "LinkedList.h"
 #include <cassert>
+#include <iterator>
+#include <utility>
 
 // Class/Data Structure member implementations /////////////////////////////////
 /**
@@ -31,7 +33,8 @@
   *
   * @pre Unintialized LinkedList
   *
-  * @post Initialized LinkedList with a null headptr and 0 itemcount
+  * @post Initialized LinkedList with a null headptr, 0 itemcount, no tombstones
+  *       and compaction once half of the nodes are tombstones
   *
   * @par Algorithm
   *     Initializes node with the initializers
@@ -41,7 +44,7 @@
   */
 template<class ItemType>
 LinkedList<ItemType> :: LinkedList()
-	: headPtr(nullptr), itemCount(0)
+	: headPtr(nullptr), itemCount(0), tombstoneCount(0), compactionThreshold(0.5)
 {
 }
 
@@ -55,11 +58,11 @@ LinkedList<ItemType> :: LinkedList()
  * @post Creates a copy of the list object
  *
  * @par Algorithm
- *      Checks if the original list is empty. Otherwise,
- *      it copies the head ptr and starts traversing the list until all
- *      items in the list is copied.
+ *      Traverses the original chain and appends a copy of every node that
+ *      is not a tombstone, so the copy starts compacted. If copying an item
+ *      throws, the nodes copied so far are freed before rethrowing
  *
- * @exception if the list is empty, it just copies the nullptr
+ * @exception if the list is empty, the head stays the nullptr
  *
  * @param[in] otherList is the list to be copied from
  *
@@ -68,46 +71,152 @@ LinkedList<ItemType> :: LinkedList()
  */
 template<class ItemType>
 LinkedList<ItemType> :: LinkedList(const LinkedList<ItemType>& otherList)
-   //: headPtr(otherList.headPtr), itemCount(otherList.itemCount)
+	: headPtr(nullptr), itemCount(otherList.itemCount), tombstoneCount(0),
+	  compactionThreshold(otherList.compactionThreshold)
 {
-	//itemCount = otherList.itemCount;
-	Node<ItemType>* origChainPtr = otherList.headPtr;
+	Node<ItemType>* newChainPtr = nullptr;
 
-	if( origChainPtr == nullptr )
+	try
 	{
-		headPtr = nullptr; // original list is empty
-	}
+		// copy every node that is not a tombstone
+		for (Node<ItemType>* origChainPtr = otherList.headPtr; origChainPtr != nullptr;
+		     origChainPtr = origChainPtr->getNext())
+		{
+			if (!origChainPtr->isRemoved())
+			{
+				// create new node with that data
+				Node<ItemType>* newNodePtr = new Node<ItemType>(origChainPtr->getItemRef());
 
-	else
-	{
-		// copy first node
-		headPtr = new Node<ItemType>();
-		headPtr->setItem(origChainPtr->getItem());
+				// link the nodes
+				if (newChainPtr == nullptr)
+				{
+					headPtr = newNodePtr;
+				}
 
-		// copy remaining nodes
-		Node<ItemType>* newChainPtr = headPtr;
-		origChainPtr = origChainPtr->getNext();
+				else
+				{
+					newChainPtr->setNext(newNodePtr);
+				}
 
-		while (origChainPtr != nullptr)
-		{
-			// get next item
-			ItemType nextItem = origChainPtr->getItem();
+				newChainPtr = newNodePtr;
+			}
+		} // end for
+	}
 
-			// create new node with that data
-			Node<ItemType>* newNodePtr = new Node<ItemType>(nextItem);
+	catch (...)
+	{
+		// the destructor does not run for a half built list
+		clear();
+		throw;
+	}
+}
 
-			// link the nodes
-			newChainPtr->setNext(newNodePtr);
+/**
+ * @brief Linked list move constructor
+ *
+ * @details Takes over the chain of an existing list without copying a node
+ *
+ * @pre none
+ *
+ * @post This list holds the entries and tombstones of otherList, which is
+ *       left empty
+ *
+ * @par Algorithm
+ *      Copies the head pointer and counts, then empties otherList
+ *
+ * @param[in] otherList is the list to move from
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+LinkedList<ItemType> :: LinkedList(LinkedList<ItemType>&& otherList) noexcept
+	: headPtr(otherList.headPtr), itemCount(otherList.itemCount),
+	  tombstoneCount(otherList.tombstoneCount), compactionThreshold(otherList.compactionThreshold)
+{
+	otherList.headPtr = nullptr;
+	otherList.itemCount = 0;
+	otherList.tombstoneCount = 0;
+}
 
-			// move pointers
-			newChainPtr = newChainPtr->getNext();
-			origChainPtr = origChainPtr->getNext();
+/**
+ * @brief Linked list copy assignment
+ *
+ * @details Strong guarantee: if copying an entry throws, this list is
+ *          unchanged
+ *
+ * @pre none
+ *
+ * @post This list holds a compacted copy of the entries of otherList
+ *
+ * @par Algorithm
+ *      Copy and swap, the copy constructor builds the new chain and the old
+ *      chain is freed with the temporary
+ *
+ * @param[in] otherList is the list to be copied from
+ *
+ * @return this list
+ *
+ */
+template<class ItemType>
+LinkedList<ItemType>& LinkedList<ItemType> :: operator=(const LinkedList<ItemType>& otherList)
+{
+	LinkedList<ItemType> copiedList(otherList);
+	swap(copiedList);
+	return *this;
+}
 
-		} // end while
+/**
+ * @brief Linked list move assignment
+ *
+ * @details Takes over the chain of otherList without copying a node
+ *
+ * @pre none
+ *
+ * @post This list holds the entries and tombstones of otherList, which is
+ *       left empty; the old entries of this list are freed
+ *
+ * @par Algorithm
+ *      Moves otherList into a temporary and swaps with it, so the old chain
+ *      is freed with the temporary, even on self assignment
+ *
+ * @param[in] otherList is the list to move from
+ *
+ * @return this list
+ *
+ */
+template<class ItemType>
+LinkedList<ItemType>& LinkedList<ItemType> :: operator=(LinkedList<ItemType>&& otherList) noexcept
+{
+	LinkedList<ItemType> movedList(static_cast<LinkedList<ItemType>&&>(otherList));
+	swap(movedList);
+	return *this;
+}
 
-		// end of list
-		newChainPtr->setNext(nullptr);
-	}
+/**
+ * @brief Exchanges the contents of two lists
+ *
+ * @details O(1), no node is copied or visited
+ *
+ * @pre none
+ *
+ * @post each list holds what the other held, including its tombstones and
+ *       compaction threshold
+ *
+ * @par none
+ *
+ * @param[in] otherList is the list to exchange with
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void LinkedList<ItemType> :: swap(LinkedList<ItemType>& otherList) noexcept
+{
+	std::swap(headPtr, otherList.headPtr);
+	std::swap(itemCount, otherList.itemCount);
+	std::swap(tombstoneCount, otherList.tombstoneCount);
+	std::swap(compactionThreshold, otherList.compactionThreshold);
 }
 
 /**
@@ -251,6 +360,12 @@ bool LinkedList<ItemType> :: remove(int position)
 	
 	if (ableToRemove)
 	{
+		// the unlinking below assumes the chain holds no tombstones
+		if (tombstoneCount > 0)
+		{
+			compact();
+		}
+
 		Node<ItemType>* currentPtr = nullptr;
 
 		if (position == 1)
@@ -299,7 +414,7 @@ bool LinkedList<ItemType> :: remove(int position)
  * @post resets the list to zero
  *
  * @par Algorithm
- *      While the list is not empty, remove from the head of the list
+ *      Deletes every node from the head of the chain, tombstones included
  *
  * @return none
  *
@@ -307,11 +422,407 @@ bool LinkedList<ItemType> :: remove(int position)
 template<class ItemType>
 void LinkedList<ItemType> ::clear()
 {
-	while (!isEmpty())
+	while (headPtr != nullptr)
+	{
+		Node<ItemType>* nextPtr = headPtr->getNext();
+		delete headPtr;
+		headPtr = nextPtr;
+	}
+
+	itemCount = 0;
+	tombstoneCount = 0;
+}
+
+/**
+ * @brief Inserts a run of entries at some position with a single traversal
+ *
+ * @details The new nodes are built into a detached chain first, then the chain
+ *          is spliced in after one walk to the node before newPosition. This is
+ *          O(n + K) where repeated calls to insert() would be O(K*n)
+ *
+ * @pre none
+ *
+ * @post If the position is valid, the entries in [first, last) occupy positions
+ *       newPosition onwards in the same order and later entries are renumbered
+ *
+ * @par Algorithm
+ *      Builds the chain of new nodes from the iterator range, finds the node
+ *      before newPosition and links the chain between it and its successor
+ *
+ * @exception none; if allocation fails the detached chain is released and the
+ *            list is left unchanged
+ *
+ * @param[in] newPosition is where the first new entry will be inserted
+ *
+ * @param[in] first is an input iterator to the first entry to insert
+ *
+ * @param[in] last is an input iterator one past the last entry to insert
+ *
+ * @return a boolean logic if the insertion could be done or not
+ *
+ */
+template<class ItemType>
+template<class InputIterator>
+bool LinkedList<ItemType> :: insertRange(int newPosition, InputIterator first, InputIterator last)
+{
+	bool ableToInsert = (newPosition >= 1) && (newPosition <= itemCount + 1);
+
+	if (ableToInsert && first != last)
+	{
+		// build the detached chain of new nodes
+		Node<ItemType>* chainHeadPtr = nullptr;
+		Node<ItemType>* chainTailPtr = nullptr;
+		int chainCount = 0;
+
+		try
+		{
+			for (; first != last; ++first)
+			{
+				Node<ItemType>* newNodePtr = new Node<ItemType>(*first);
+
+				if (chainTailPtr == nullptr)
+				{
+					chainHeadPtr = newNodePtr;
+				}
+
+				else
+				{
+					chainTailPtr->setNext(newNodePtr);
+				}
+
+				chainTailPtr = newNodePtr;
+				chainCount++;
+			}
+		}
+
+		catch (...)
+		{
+			// release the partial chain, the list itself was not touched
+			while (chainHeadPtr != nullptr)
+			{
+				Node<ItemType>* nextPtr = chainHeadPtr->getNext();
+				delete chainHeadPtr;
+				chainHeadPtr = nextPtr;
+			}
+
+			throw;
+		}
+
+		// splice the chain in
+		if (newPosition == 1)
+		{
+			chainTailPtr->setNext(headPtr);
+			headPtr = chainHeadPtr;
+		}
+
+		else
+		{
+			Node<ItemType>* prevPtr = getNodeAt(newPosition - 1);
+			chainTailPtr->setNext(prevPtr->getNext());
+			prevPtr->setNext(chainHeadPtr);
+		}
+
+		itemCount += chainCount;
+	}
+
+	return ableToInsert;
+}
+
+/**
+ * @brief Removes a run of consecutive entries with a single traversal
+ *
+ * @details Walks once to the node before firstPosition, then unlinks and
+ *          deletes every node up to and including lastPosition
+ *
+ * @pre none
+ *
+ * @post If 1 <= firstPosition <= lastPosition <= getLength(), the entries in
+ *       that range are removed and later entries are renumbered
+ *
+ * @par Algorithm
+ *      Finds the node before the range, deletes the nodes of the range while
+ *      walking forward, then reconnects the chain around the gap
+ *
+ * @exception none
+ *
+ * @param[in] firstPosition is the position of the first entry to remove
+ *
+ * @param[in] lastPosition is the position of the last entry to remove
+ *
+ * @return A booleon for successful removal or not
+ *
+ */
+template<class ItemType>
+bool LinkedList<ItemType> :: removeRange(int firstPosition, int lastPosition)
+{
+	bool ableToRemove = (firstPosition >= 1) && (firstPosition <= lastPosition)
+	                    && (lastPosition <= itemCount);
+
+	if (ableToRemove)
+	{
+		if (tombstoneCount > 0)
+		{
+			compact();
+		}
+
+		Node<ItemType>* prevPtr = nullptr;
+		Node<ItemType>* currentPtr = headPtr;
+
+		if (firstPosition > 1)
+		{
+			prevPtr = getNodeAt(firstPosition - 1);
+			currentPtr = prevPtr->getNext();
+		}
+
+		// delete the nodes of the range
+		for (int count = firstPosition; count <= lastPosition; count++)
+		{
+			Node<ItemType>* nextPtr = currentPtr->getNext();
+			delete currentPtr;
+			currentPtr = nextPtr;
+		}
+
+		// reconnect the chain around the removed range
+		if (prevPtr == nullptr)
+		{
+			headPtr = currentPtr;
+		}
+
+		else
+		{
+			prevPtr->setNext(currentPtr);
+		}
+
+		itemCount -= lastPosition - firstPosition + 1;
+	}
+
+	return ableToRemove;
+}
+
+/**
+ * @brief Replaces a run of consecutive entries with a single traversal
+ *
+ * @details Overwrites the entries starting at position with the entries in
+ *          [first, last). No nodes are allocated or freed
+ *
+ * @pre none
+ *
+ * @post If the whole run fits in the list, the entries starting at position
+ *       hold the new entries; otherwise the list is unchanged
+ *
+ * @par Algorithm
+ *      Counts the new entries to check the bounds, walks once to position and
+ *      sets the item of each following node
+ *
+ * @exception none
+ *
+ * @param[in] position is the position of the first entry to replace
+ *
+ * @param[in] first is a forward iterator to the first replacement entry
+ *
+ * @param[in] last is a forward iterator one past the last replacement entry
+ *
+ * @return a boolean logic if the replacement could be done or not
+ *
+ */
+template<class ItemType>
+template<class ForwardIterator>
+bool LinkedList<ItemType> :: replaceRange(int position, ForwardIterator first, ForwardIterator last)
+{
+	long runLength = static_cast<long>(std::distance(first, last));
+	bool ableToSet = (position >= 1) && (position - 1 + runLength <= itemCount);
+
+	if (ableToSet && runLength > 0)
+	{
+		if (tombstoneCount > 0)
+		{
+			compact();
+		}
+
+		Node<ItemType>* currentPtr = getNodeAt(position);
+
+		for (; first != last; ++first)
+		{
+			currentPtr->setItem(*first);
+			currentPtr = currentPtr->getNext();
+		}
+	}
+
+	return ableToSet;
+}
+
+/**
+ * @brief Applies a sorted batch of positional edits with a single traversal
+ *
+ * @details Every edit position refers to the list as it was before the batch,
+ *          so the caller does not have to renumber edits after earlier ones.
+ *          An insert at position p goes before the original entry p (p may be
+ *          getLength() + 1 to append), a remove or replace acts on the original
+ *          entry p. Edits must be sorted by position; several inserts may share
+ *          a position and keep their order, and at most one remove or replace
+ *          may follow them at that position
+ *
+ * @pre none
+ *
+ * @post If the batch is valid every edit has been applied, otherwise the list
+ *       is unchanged
+ *
+ * @par Algorithm
+ *      Validates the batch and allocates the inserted nodes up front, then
+ *      walks the chain once, keeping the node before the current original
+ *      entry so that each edit is applied in constant time
+ *
+ * @exception none; if allocation fails the list is left unchanged
+ *
+ * @param[in] first is a forward iterator to the first ListEdit
+ *
+ * @param[in] last is a forward iterator one past the last ListEdit
+ *
+ * @return a boolean logic if the batch was valid and applied or not
+ *
+ * @note runs in O(n + K) for a list of n entries and a batch of K edits
+ *
+ */
+template<class ItemType>
+template<class ForwardIterator>
+bool LinkedList<ItemType> :: applyOps(ForwardIterator first, ForwardIterator last)
+{
+	// validate the batch before touching the list
+	int lastPosition = 1;
+	bool positionClosed = false;
+	bool ableToApply = true;
+
+	for (ForwardIterator editIt = first; ableToApply && editIt != last; ++editIt)
+	{
+		const ListEdit<ItemType>& edit = *editIt;
+		int maxPosition = (edit.kind == LIST_EDIT_INSERT) ? itemCount + 1 : itemCount;
+
+		if (edit.position < lastPosition || edit.position > maxPosition
+		    || (edit.position == lastPosition && positionClosed))
+		{
+			ableToApply = false;
+		}
+
+		else
+		{
+			positionClosed = (edit.kind != LIST_EDIT_INSERT);
+			lastPosition = edit.position;
+		}
+	}
+
+	if (!ableToApply)
+	{
+		return false;
+	}
+
+	if (tombstoneCount > 0)
+	{
+		compact();
+	}
+
+	// allocate every inserted node before changing the chain
+	Node<ItemType>* spareHeadPtr = nullptr;
+	Node<ItemType>* spareTailPtr = nullptr;
+
+	try
 	{
-		remove(1);
+		for (ForwardIterator editIt = first; editIt != last; ++editIt)
+		{
+			if ((*editIt).kind == LIST_EDIT_INSERT)
+			{
+				Node<ItemType>* newNodePtr = new Node<ItemType>((*editIt).item);
+
+				if (spareTailPtr == nullptr)
+				{
+					spareHeadPtr = newNodePtr;
+				}
+
+				else
+				{
+					spareTailPtr->setNext(newNodePtr);
+				}
+
+				spareTailPtr = newNodePtr;
+			}
+		}
+	}
+
+	catch (...)
+	{
+		while (spareHeadPtr != nullptr)
+		{
+			Node<ItemType>* nextPtr = spareHeadPtr->getNext();
+			delete spareHeadPtr;
+			spareHeadPtr = nextPtr;
+		}
+
+		throw;
+	}
+
+	// walk the chain once; currentPtr is the original entry at originalPosition
+	Node<ItemType>* prevPtr = nullptr;
+	Node<ItemType>* currentPtr = headPtr;
+	int originalPosition = 1;
+
+	for (; first != last; ++first)
+	{
+		const ListEdit<ItemType>& edit = *first;
+
+		while (originalPosition < edit.position)
+		{
+			prevPtr = currentPtr;
+			currentPtr = currentPtr->getNext();
+			originalPosition++;
+		}
+
+		if (edit.kind == LIST_EDIT_INSERT)
+		{
+			// take the next preallocated node and link it before currentPtr
+			Node<ItemType>* newNodePtr = spareHeadPtr;
+			spareHeadPtr = spareHeadPtr->getNext();
+			newNodePtr->setNext(currentPtr);
+
+			if (prevPtr == nullptr)
+			{
+				headPtr = newNodePtr;
+			}
+
+			else
+			{
+				prevPtr->setNext(newNodePtr);
+			}
+
+			prevPtr = newNodePtr;
+			itemCount++;
+		}
+
+		else if (edit.kind == LIST_EDIT_REMOVE)
+		{
+			Node<ItemType>* nextPtr = currentPtr->getNext();
+
+			if (prevPtr == nullptr)
+			{
+				headPtr = nextPtr;
+			}
+
+			else
+			{
+				prevPtr->setNext(nextPtr);
+			}
+
+			delete currentPtr;
+			currentPtr = nextPtr;
+			originalPosition++;
+			itemCount--;
+		}
+
+		else
+		{
+			currentPtr->setItem(edit.item);
+		}
 	}
-	//cout << "List has been cleared!" << endl;
+
+	return true;
 }
 
 /**
@@ -339,7 +850,7 @@ void LinkedList<ItemType> ::clear()
  *
  */
 template<class ItemType>
-ItemType LinkedList<ItemType>::getEntry(int position) const throw(PrecondViolatedExcept)
+ItemType LinkedList<ItemType>::getEntry(int position) const
 {
 	bool ableToGet = (position >= 1) && (position <= itemCount);
 	if (ableToGet)
@@ -386,7 +897,7 @@ ItemType LinkedList<ItemType>::getEntry(int position) const throw(PrecondViolate
  *
  */
 template<class ItemType>
-ItemType LinkedList<ItemType> :: replace(int position, const ItemType& newEntry) throw(PrecondViolatedExcept)
+ItemType LinkedList<ItemType> :: replace(int position, const ItemType& newEntry)
 {
 	// precondition
 	bool ableToSet = (position >= 1) && (position <= itemCount);
@@ -408,6 +919,413 @@ ItemType LinkedList<ItemType> :: replace(int position, const ItemType& newEntry)
 	}
 }
 
+/**
+ * @brief Gets the entry at some position without throwing
+ *
+ * @details Fast path for lookups where an out of range position is an expected
+ *          outcome rather than an error. No message is built and nothing is thrown
+ *
+ * @pre none
+ *
+ * @post If the position is valid, entry holds a copy of the data at that
+ *       position; otherwise entry is left untouched
+ *
+ * @par Algorithm
+ *      If the position is within bounds, copy the item of that node out
+ *
+ * @exception none; noexcept whenever copying an ItemType cannot throw
+ *
+ * @param[in] position is where the method will attempt to retrieve the data
+ *
+ * @param[out] entry receives the data at the given position
+ *
+ * @return a boolean logic if the entry was retrieved or not
+ *
+ */
+template<class ItemType>
+bool LinkedList<ItemType> :: tryGetEntry(int position, ItemType& entry) const
+	noexcept(std::is_nothrow_copy_assignable<ItemType>::value)
+{
+	bool ableToGet = (position >= 1) && (position <= itemCount);
+
+	if (ableToGet)
+	{
+		entry = getNodeAt(position)->getItemRef();
+	}
+
+	return ableToGet;
+}
+
+/**
+ * @brief Replaces the entry at some position without throwing
+ *
+ * @details Fast path counterpart of replace() that reports a bad position
+ *          through its return value
+ *
+ * @pre none
+ *
+ * @post If the position is valid, the entry at that position is newEntry;
+ *       otherwise the list is unchanged
+ *
+ * @par Algorithm
+ *      If the position is within bounds, set the item of that node
+ *
+ * @exception none; noexcept whenever copying an ItemType cannot throw
+ *
+ * @param[in] position is the location in the list for where the item is to be replaced
+ *
+ * @param[in] newEntry is the replacement item
+ *
+ * @return a boolean logic if the replacement could be done or not
+ *
+ */
+template<class ItemType>
+bool LinkedList<ItemType> :: tryReplace(int position, const ItemType& newEntry)
+	noexcept(std::is_nothrow_copy_assignable<ItemType>::value)
+{
+	bool ableToSet = (position >= 1) && (position <= itemCount);
+
+	if (ableToSet)
+	{
+		getNodeAt(position)->getItemRef() = newEntry;
+	}
+
+	return ableToSet;
+}
+
+/**
+ * @brief Unchecked access to the entry at some position
+ *
+ * @details For positions the caller has already validated. Bounds are only
+ *          checked by the assert in getNodeAt() in debug builds
+ *
+ * @pre 1 <= position <= getLength()
+ *
+ * @post returns a reference to the data at that position
+ *
+ * @par Algorithm
+ *      Gets the node at the position and returns a reference to its item
+ *
+ * @exception none
+ *
+ * @param[in] position is where the data is at
+ *
+ * @return a reference to the entry, which may be modified in place
+ *
+ */
+template<class ItemType>
+ItemType& LinkedList<ItemType> :: operator[](int position)
+{
+	return getNodeAt(position)->getItemRef();
+}
+
+/**
+ * @brief Unchecked read only access to the entry at some position
+ *
+ * @details Same as the non const operator[] but for const lists
+ *
+ * @pre 1 <= position <= getLength()
+ *
+ * @post returns a const reference to the data at that position
+ *
+ * @par Algorithm
+ *      Gets the node at the position and returns a reference to its item
+ *
+ * @exception none
+ *
+ * @param[in] position is where the data is at
+ *
+ * @return a const reference to the entry
+ *
+ */
+template<class ItemType>
+const ItemType& LinkedList<ItemType> :: operator[](int position) const
+{
+	return getNodeAt(position)->getItemRef();
+}
+
+/**
+ * @brief Visits the entries of the list in order in a single pass
+ *
+ * @details Lets generic code walk the whole chain in O(n) instead of calling
+ *          getEntry() for every position. The visitor is a template argument,
+ *          so the call is inlined
+ *
+ * @pre visit can be called as bool(const ItemType&)
+ *
+ * @post visit has been called on each entry, front to back, until it returned false
+ *
+ * @par Algorithm
+ *      Walks the chain from the head skipping tombstones, stopping at the end
+ *      of the chain or as soon as visit returns false
+ *
+ * @exception none, other than what visit throws
+ *
+ * @param[in] visit is called with each entry and returns false to stop early
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+template<class Visitor>
+void LinkedList<ItemType> :: traverse(Visitor visit) const
+{
+	for (Node<ItemType>* currentPtr = headPtr; currentPtr != nullptr;
+	     currentPtr = currentPtr->getNext())
+	{
+		if (!currentPtr->isRemoved() && !visit(currentPtr->getItemRef()))
+		{
+			break;
+		}
+	}
+}
+
+/**
+ * @brief Gets an iterator at the first entry
+ *
+ * @details Lets the list be used in range based for loops, with the
+ *          standard algorithms and as the source of a ListView
+ *
+ * @pre none
+ *
+ * @post none
+ *
+ * @par none
+ *
+ * @return a read only iterator at the first entry, or end() for an empty list
+ *
+ */
+template<class ItemType>
+ListIterator<ItemType> LinkedList<ItemType> :: begin() const
+{
+	return ListIterator<ItemType>(headPtr);
+}
+
+/**
+ * @brief Gets an iterator past the last entry
+ *
+ * @details none
+ *
+ * @pre none
+ *
+ * @post none
+ *
+ * @par none
+ *
+ * @return the end iterator
+ *
+ */
+template<class ItemType>
+ListIterator<ItemType> LinkedList<ItemType> :: end() const
+{
+	return ListIterator<ItemType>();
+}
+
+/**
+ * @brief Removes an entry lazily by marking its node as a tombstone
+ *
+ * @details The node stays linked but is hidden from getLength(), getEntry()
+ *          and traverse(). Tombstones are unlinked and freed together by
+ *          compact(), which runs on its own once the share of tombstones
+ *          passes the compaction threshold, or before the next remove.
+ *
+ *          Each call still walks from the head to the position, stepping over
+ *          any tombstones, so marking K entries one by one costs O(K*n). For a
+ *          sweep, use removeIf() to remove by predicate, or applyOps() with
+ *          LIST_EDIT_REMOVE edits to remove by position; both take a single
+ *          pass, O(n + K)
+ *
+ * @pre none
+ *
+ * @post If 1 <= position <= getLength(), the entry at that position is gone
+ *       from the list and later entries are renumbered
+ *
+ * @par Algorithm
+ *      Finds the node at the position and sets its removed flag, then
+ *      compacts if the tombstone ratio is over the threshold
+ *
+ * @exception none
+ *
+ * @param[in] position is the position of the entry to remove
+ *
+ * @return A booleon for successful removal or not
+ *
+ */
+template<class ItemType>
+bool LinkedList<ItemType> :: markRemoved(int position)
+{
+	bool ableToRemove = (position >= 1) && (position <= itemCount);
+
+	if (ableToRemove)
+	{
+		getNodeAt(position)->setRemoved(true);
+		itemCount--;
+		tombstoneCount++;
+
+		if (tombstoneCount > compactionThreshold * (itemCount + tombstoneCount))
+		{
+			compact();
+		}
+	}
+
+	return ableToRemove;
+}
+
+/**
+ * @brief Removes every entry that satisfies a predicate in one pass
+ *
+ * @details Also unlinks any tombstones, so the list is compacted afterwards.
+ *          This is O(n) where removing each entry by position is O(K*n)
+ *
+ * @pre pred can be called as bool(const ItemType&)
+ *
+ * @post No remaining entry satisfies pred and the list holds no tombstones
+ *
+ * @par Algorithm
+ *      Walks the chain once keeping the last kept node, unlinking and
+ *      deleting every tombstone and every entry pred accepts
+ *
+ * @exception none, other than what pred throws
+ *
+ * @param[in] pred is called with each entry and returns true to remove it
+ *
+ * @return the number of entries removed, not counting earlier tombstones
+ *
+ */
+template<class ItemType>
+template<class Predicate>
+int LinkedList<ItemType> :: removeIf(Predicate pred)
+{
+	int removedCount = 0;
+	Node<ItemType>* prevPtr = nullptr;
+	Node<ItemType>* currentPtr = headPtr;
+
+	while (currentPtr != nullptr)
+	{
+		Node<ItemType>* nextPtr = currentPtr->getNext();
+		bool wasTombstone = currentPtr->isRemoved();
+
+		if (wasTombstone || pred(static_cast<const ItemType&>(currentPtr->getItemRef())))
+		{
+			// unlink and free the node
+			if (prevPtr == nullptr)
+			{
+				headPtr = nextPtr;
+			}
+
+			else
+			{
+				prevPtr->setNext(nextPtr);
+			}
+
+			delete currentPtr;
+
+			if (wasTombstone)
+			{
+				tombstoneCount--;
+			}
+
+			else
+			{
+				itemCount--;
+				removedCount++;
+			}
+		}
+
+		else
+		{
+			prevPtr = currentPtr;
+		}
+
+		currentPtr = nextPtr;
+	}
+
+	return removedCount;
+}
+
+/**
+ * @brief Unlinks and frees every tombstone in one pass
+ *
+ * @details none
+ *
+ * @pre none
+ *
+ * @post the list holds no tombstones; entries and positions are unchanged
+ *
+ * @par Algorithm
+ *      Uses removeIf() with a predicate that keeps every entry
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void LinkedList<ItemType> :: compact()
+{
+	if (tombstoneCount > 0)
+	{
+		removeIf([](const ItemType&) { return false; });
+	}
+}
+
+/**
+ * @brief Gets the number of tombstones waiting for compaction
+ *
+ * @return the number of nodes marked removed but still linked
+ *
+ */
+template<class ItemType>
+int LinkedList<ItemType> :: getTombstoneCount() const
+{
+	return tombstoneCount;
+}
+
+/**
+ * @brief Sets when markRemoved() compacts on its own
+ *
+ * @details none
+ *
+ * @pre none
+ *
+ * @post markRemoved() compacts once tombstones make up more than
+ *       tombstoneRatio of the nodes; a ratio of 1 or more leaves compaction
+ *       to compact(), remove() and the batched functions
+ *
+ * @par none
+ *
+ * @param[in] tombstoneRatio is the share of tombstones that triggers compaction
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void LinkedList<ItemType> :: setCompactionThreshold(double tombstoneRatio)
+{
+	compactionThreshold = tombstoneRatio;
+}
+
+/**
+ * @brief Gets the memory held by the list
+ *
+ * @details Counts the list object and one Node per entry or tombstone. Each node is a
+ *          separate heap allocation, so the allocator adds its own header and
+ *          rounding on top of this figure. Heap memory owned by the entries
+ *          themselves, such as a std::string buffer, is not counted
+ *
+ * @pre none
+ *
+ * @post none
+ *
+ * @par none
+ *
+ * @return the footprint of the list in bytes
+ *
+ */
+template<class ItemType>
+std::size_t LinkedList<ItemType> :: memoryUsage() const
+{
+	return sizeof(*this) + static_cast<std::size_t>(itemCount + tombstoneCount) * sizeof(Node<ItemType>);
+}
+
 /**
  * @brief Gets the node at the given position
  *
@@ -419,7 +1337,7 @@ ItemType LinkedList<ItemType> :: replace(int position, const ItemType& newEntry)
  *
  * @par Algorithm
  *      Loops to where the position is and returns a pointer to 
- *      that node at that position
+ *      that node at that position; tombstones are skipped and not counted
  *
  * @exception none
  *
@@ -441,9 +1359,29 @@ Node<ItemType>* LinkedList<ItemType> :: getNodeAt(int position) const
 	// Loop from beginning of chain
 	Node<ItemType>* current = headPtr;
 
-	for (count = 1; count < position; count++)
+	if (tombstoneCount == 0)
 	{
-		current = current->getNext();
+		for (count = 1; count < position; count++)
+		{
+			current = current->getNext();
+		}
+	}
+
+	else
+	{
+		// count only nodes that are not tombstones
+		while (current->isRemoved())
+		{
+			current = current->getNext();
+		}
+
+		for (count = 1; count < position; count++)
+		{
+			do
+			{
+				current = current->getNext();
+			} while (current->isRemoved());
+		}
 	}
 
 	return current;
@@ -5,7 +5,8 @@
  * @brief Header file for Linked List
  *
  * @details Linked List header files that inherits a ListInterface publicly
- *          for its member functions
+ *          for its member functions, and a StaticListInterface so that generic
+ *          code can call them without virtual dispatch
  *
  * @version 1.01
  *          Hadi Rumjahn (18 September 2016)
@@ -20,19 +21,33 @@
 #define LINKED_LIST_H
 
 // Header Files ///////////////////////////////////////////////////////////
+#include <cstddef>
 #include <iostream>
+#include <type_traits>
 #include "ListInterface.h"
+#include "StaticListInterface.h"
+#include "ListEdit.h"
+#include "ListIterator.h"
 #include "Node.h"
 #include "PrecondViolatedExcep.h"
 
 // Linked List Templated Class Definition /////////////////////////////////
 template<class ItemType>
-class LinkedList : public ListInterface<ItemType> {
+class LinkedList : public ListInterface<ItemType>,
+                   public StaticListInterface<LinkedList<ItemType>, ItemType> {
 public:
+	typedef ListIterator<ItemType> const_iterator;
+
 	LinkedList();
 	LinkedList(const LinkedList<ItemType>& otherList);
+	LinkedList(LinkedList<ItemType>&& otherList) noexcept;
 	virtual ~LinkedList();
 
+	// assignment, copies and moves own their chain
+	LinkedList<ItemType>& operator=(const LinkedList<ItemType>& otherList);
+	LinkedList<ItemType>& operator=(LinkedList<ItemType>&& otherList) noexcept;
+	void swap(LinkedList<ItemType>& otherList) noexcept;
+
 	// functions for the list
 	bool isEmpty() const;
 	int getLength() const;
@@ -40,13 +55,51 @@ public:
 	bool remove(int position);
 	void clear();
 
+	// batched functions, each walks the chain once
+	template<class InputIterator>
+	bool insertRange(int newPosition, InputIterator first, InputIterator last);
+	bool removeRange(int firstPosition, int lastPosition);
+	template<class ForwardIterator>
+	bool replaceRange(int position, ForwardIterator first, ForwardIterator last);
+	template<class ForwardIterator>
+	bool applyOps(ForwardIterator first, ForwardIterator last);
+
 	// ItemType functions
-	ItemType getEntry(int position) const throw(PrecondViolatedExcept);
-	ItemType replace(int position, const ItemType& newEntry) throw(PrecondViolatedExcept);
+	ItemType getEntry(int position) const;
+	ItemType replace(int position, const ItemType& newEntry);
+
+	// non-throwing and unchecked ItemType functions
+	bool tryGetEntry(int position, ItemType& entry) const
+		noexcept(std::is_nothrow_copy_assignable<ItemType>::value);
+	bool tryReplace(int position, const ItemType& newEntry)
+		noexcept(std::is_nothrow_copy_assignable<ItemType>::value);
+	ItemType& operator[](int position);
+	const ItemType& operator[](int position) const;
+
+	// visits every entry in order in a single pass
+	template<class Visitor>
+	void traverse(Visitor visit) const;
+
+	// read only iteration over the entries
+	ListIterator<ItemType> begin() const;
+	ListIterator<ItemType> end() const;
+
+	// lazy deletion with tombstones
+	bool markRemoved(int position);
+	template<class Predicate>
+	int removeIf(Predicate pred);
+	void compact();
+	int getTombstoneCount() const;
+	void setCompactionThreshold(double tombstoneRatio);
+
+	// memory accounting
+	std::size_t memoryUsage() const;
 
 private:
 	Node<ItemType>* headPtr;
-	int itemCount;
+	int itemCount;      // entries, not counting tombstones
+	int tombstoneCount; // nodes marked removed but still linked
+	double compactionThreshold;
 	Node<ItemType>* getNodeAt(int position) const;
 };
 
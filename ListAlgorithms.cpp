@@ -0,0 +1,127 @@
+// Program Information //////////////////////////////////////////////////////////
+/**
+ * @file ListAlgorithms.cpp
+ *
+ * @brief Implementation file for the generic list algorithms
+ *
+ * @details Each algorithm makes a single pass with traverse() rather than
+ *          calling getEntry() per position, so it is linear for linked lists
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives /////////////////////////////////////////////////////
+#ifndef LIST_ALGORITHMS_CPP
+#define LIST_ALGORITHMS_CPP
+
+// Header Files ////////////////////////////////////////////////////////////////
+#include "ListAlgorithms.h"
+
+// Generic list algorithm implementations //////////////////////////////////////
+/**
+ * @brief Finds the position of the first entry equal to target
+ *
+ * @details none
+ *
+ * @pre ItemType supports operator==
+ *
+ * @post none, the list is not modified
+ *
+ * @par Algorithm
+ *      Traverses the list counting positions and stops at the first match
+ *
+ * @param[in] list is the list to search
+ *
+ * @param[in] target is the entry to look for, converted to ItemType
+ *
+ * @return the position of the first match, or 0 if there is none
+ *
+ */
+template<class Derived, class ItemType>
+int findPosition(const StaticListInterface<Derived, ItemType>& list,
+                 const typename NonDeduced<ItemType>::type& target)
+{
+	int position = 0;
+	bool found = false;
+
+	list.traverse([&](const ItemType& entry) -> bool
+	{
+		position++;
+		found = (entry == target);
+		return !found;
+	});
+
+	return found ? position : 0;
+}
+
+/**
+ * @brief Counts the entries that satisfy a predicate
+ *
+ * @details none
+ *
+ * @pre pred can be called as bool(const ItemType&)
+ *
+ * @post none, the list is not modified
+ *
+ * @par Algorithm
+ *      Traverses the whole list and counts the entries pred accepts
+ *
+ * @param[in] list is the list to examine
+ *
+ * @param[in] pred is the predicate to test each entry with
+ *
+ * @return the number of entries for which pred returned true
+ *
+ */
+template<class Derived, class ItemType, class Predicate>
+int countIf(const StaticListInterface<Derived, ItemType>& list, Predicate pred)
+{
+	int count = 0;
+
+	list.traverse([&](const ItemType& entry) -> bool
+	{
+		if (pred(entry))
+		{
+			count++;
+		}
+
+		return true;
+	});
+
+	return count;
+}
+
+/**
+ * @brief Combines all entries of the list into a single result
+ *
+ * @details Left fold: combine(...combine(combine(initial, e1), e2)..., en)
+ *
+ * @pre combine can be called as Result(const Result&, const ItemType&)
+ *
+ * @post none, the list is not modified
+ *
+ * @par Algorithm
+ *      Traverses the whole list folding each entry into the running result
+ *
+ * @param[in] list is the list to fold
+ *
+ * @param[in] initial is the starting value of the result
+ *
+ * @param[in] combine folds one entry into the running result
+ *
+ * @return the folded result, or initial for an empty list
+ *
+ */
+template<class Derived, class ItemType, class Result, class Combine>
+Result foldList(const StaticListInterface<Derived, ItemType>& list, Result initial, Combine combine)
+{
+	list.traverse([&](const ItemType& entry) -> bool
+	{
+		initial = combine(initial, entry);
+		return true;
+	});
+
+	return initial;
+}
+
+#endif // end LIST_ALGORITHMS_CPP
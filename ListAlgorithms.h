@@ -0,0 +1,39 @@
+// Program Information /////////////////////////////////////////////////////
+/**
+ * @file ListAlgorithms.h
+ *
+ * @brief Header file for the generic list algorithms
+ *
+ * @details Algorithms written against StaticListInterface so they work with
+ *          any list type and are resolved and inlined at compile time
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives ////////////////////////////////////////////////
+#ifndef LIST_ALGORITHMS_H
+#define LIST_ALGORITHMS_H
+
+// Header Files ///////////////////////////////////////////////////////////
+#include "StaticListInterface.h"
+
+// Keeps a parameter out of template argument deduction, so ItemType is
+// taken from the list alone and the argument converts to it
+template<class Type>
+struct NonDeduced {
+	typedef Type type;
+};
+
+// Generic list algorithm declarations ////////////////////////////////////
+template<class Derived, class ItemType>
+int findPosition(const StaticListInterface<Derived, ItemType>& list,
+                 const typename NonDeduced<ItemType>::type& target);
+
+template<class Derived, class ItemType, class Predicate>
+int countIf(const StaticListInterface<Derived, ItemType>& list, Predicate pred);
+
+template<class Derived, class ItemType, class Result, class Combine>
+Result foldList(const StaticListInterface<Derived, ItemType>& list, Result initial, Combine combine);
+
+#include "ListAlgorithms.cpp"
+#endif // end LIST_ALGORITHMS_H
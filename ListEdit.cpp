@@ -0,0 +1,92 @@
+// Program Information /////////////////////////////////////////////////////
+/**
+ * @file ListEdit.cpp
+ *
+ * @brief Implementation file for ListEdit
+ *
+ * @details Implements the constructors of the ListEdit record
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives ///////////////////////////////////////////////////
+#ifndef LIST_EDIT_CPP
+#define LIST_EDIT_CPP
+
+// Header Files //////////////////////////////////////////////////////////////
+#include "ListEdit.h"
+
+/**
+ * @brief Default edit constructor
+ *
+ * @details none
+ *
+ * @pre none
+ *
+ * @post Creates a remove edit at the invalid position 0
+ *
+ * @par Algorithm
+ *      Initializes the kind and position, item is default constructed
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+ListEdit<ItemType> :: ListEdit()
+	: kind(LIST_EDIT_REMOVE), position(0), item()
+{
+}
+
+/**
+ * @brief Parameterized constructor for an edit without data
+ *
+ * @details Used for removals, which do not carry an item
+ *
+ * @pre none
+ *
+ * @post Creates an edit of the given kind at the given position
+ *
+ * @par Algorithm
+ *      Initializes the kind and position, item is default constructed
+ *
+ * @param[in] editKind is what the edit does
+ *
+ * @param[in] editPosition is the position the edit applies to
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+ListEdit<ItemType> :: ListEdit(ListEditKind editKind, int editPosition)
+	: kind(editKind), position(editPosition), item()
+{
+}
+
+/**
+ * @brief Parameterized constructor for an edit with data
+ *
+ * @details Used for insertions and replacements
+ *
+ * @pre none
+ *
+ * @post Creates an edit of the given kind at the given position with data
+ *
+ * @par Algorithm
+ *      Initializes all data members of the class
+ *
+ * @param[in] editKind is what the edit does
+ *
+ * @param[in] editPosition is the position the edit applies to
+ *
+ * @param[in] data is the item to insert or the replacement item
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+ListEdit<ItemType> :: ListEdit(ListEditKind editKind, int editPosition, const ItemType& data)
+	: kind(editKind), position(editPosition), item(data)
+{
+}
+
+#endif // end LIST_EDIT_CPP
@@ -0,0 +1,43 @@
+// Program Information ///////////////////////////
+/**
+ * @file ListEdit.h
+ *
+ * @brief Header file for ListEdit
+ *
+ * @details Describes a single positional edit (insert, remove or replace)
+ *          so that a sorted batch of edits can be handed to
+ *          LinkedList::applyOps and applied in one traversal
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives ///////////////////////
+#ifndef LIST_EDIT_H
+#define LIST_EDIT_H
+
+// Header Files
+
+	// none
+
+// Kind of edit carried by a ListEdit
+enum ListEditKind {
+	LIST_EDIT_INSERT,
+	LIST_EDIT_REMOVE,
+	LIST_EDIT_REPLACE
+};
+
+// ListEdit class templated definition
+template<class ItemType>
+class ListEdit {
+public:
+	ListEdit();
+	ListEdit(ListEditKind editKind, int editPosition);
+	ListEdit(ListEditKind editKind, int editPosition, const ItemType& data);
+
+	ListEditKind kind;
+	int position;
+	ItemType item;
+};
+
+#include "ListEdit.cpp"
+#endif  // end LIST_EDIT_H
@@ -0,0 +1,166 @@
+// Program Information /////////////////////////////////////////////////////
+/**
+ * @file ListIterator.cpp
+ *
+ * @brief Implementation file for the Linked List iterator
+ *
+ * @details Implements all functions and methods defined by the ListIterator class
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives ///////////////////////////////////////////////////
+#ifndef LIST_ITERATOR_CPP
+#define LIST_ITERATOR_CPP
+
+// Header Files //////////////////////////////////////////////////////////////
+#include "ListIterator.h"
+
+/**
+ * @brief Default iterator constructor
+ *
+ * @details The default iterator is the end of every chain
+ *
+ * @pre none
+ *
+ * @post Creates an end iterator
+ *
+ * @par none
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+ListIterator<ItemType> :: ListIterator() : current(nullptr)
+{
+}
+
+/**
+ * @brief Parameterized iterator constructor
+ *
+ * @details Starts at nodePtr, or at the first node after it that is not a
+ *          tombstone
+ *
+ * @pre none
+ *
+ * @post Creates an iterator at the first entry from nodePtr onwards
+ *
+ * @par none
+ *
+ * @param[in] nodePtr is the node to start at, nullptr for the end
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+ListIterator<ItemType> :: ListIterator(const Node<ItemType>* nodePtr) : current(nodePtr)
+{
+	skipRemoved();
+}
+
+/**
+ * @brief Gets the entry the iterator is at
+ *
+ * @pre the iterator is not at the end
+ *
+ * @return a const reference to the entry
+ *
+ */
+template<class ItemType>
+const ItemType& ListIterator<ItemType> :: operator*() const
+{
+	return current->getItemRef();
+}
+
+/**
+ * @brief Gets a pointer to the entry the iterator is at
+ *
+ * @pre the iterator is not at the end
+ *
+ * @return a const pointer to the entry
+ *
+ */
+template<class ItemType>
+const ItemType* ListIterator<ItemType> :: operator->() const
+{
+	return &current->getItemRef();
+}
+
+/**
+ * @brief Moves to the next entry
+ *
+ * @pre the iterator is not at the end
+ *
+ * @post the iterator is at the next entry or at the end
+ *
+ * @return this iterator
+ *
+ */
+template<class ItemType>
+ListIterator<ItemType>& ListIterator<ItemType> :: operator++()
+{
+	current = current->getNext();
+	skipRemoved();
+	return *this;
+}
+
+/**
+ * @brief Moves to the next entry
+ *
+ * @pre the iterator is not at the end
+ *
+ * @post the iterator is at the next entry or at the end
+ *
+ * @return a copy of the iterator from before the move
+ *
+ */
+template<class ItemType>
+ListIterator<ItemType> ListIterator<ItemType> :: operator++(int)
+{
+	ListIterator<ItemType> before = *this;
+	++(*this);
+	return before;
+}
+
+/**
+ * @brief Checks if two iterators are at the same node
+ *
+ * @return true if both are at the same node or both at the end
+ *
+ */
+template<class ItemType>
+bool ListIterator<ItemType> :: operator==(const ListIterator<ItemType>& other) const
+{
+	return current == other.current;
+}
+
+/**
+ * @brief Checks if two iterators are at different nodes
+ *
+ * @return the opposite of operator==
+ *
+ */
+template<class ItemType>
+bool ListIterator<ItemType> :: operator!=(const ListIterator<ItemType>& other) const
+{
+	return current != other.current;
+}
+
+/**
+ * @brief Moves past any tombstones
+ *
+ * @post the iterator is at an entry or at the end
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void ListIterator<ItemType> :: skipRemoved()
+{
+	while (current != nullptr && current->isRemoved())
+	{
+		current = current->getNext();
+	}
+}
+
+#endif // end LIST_ITERATOR_CPP
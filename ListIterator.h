@@ -0,0 +1,51 @@
+// Program Information ///////////////////////////
+/**
+ * @file ListIterator.h
+ *
+ * @brief Header file for the Linked List iterator
+ *
+ * @details Read only forward iterator over the chain of a LinkedList.
+ *          Tombstoned nodes are skipped, so it visits exactly the entries
+ *          of the list. Works with range based for loops and the standard
+ *          algorithms, and is the source iterator of ListView
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives ///////////////////////
+#ifndef LIST_ITERATOR_H
+#define LIST_ITERATOR_H
+
+// Header Files
+#include <cstddef>
+#include <iterator>
+#include "Node.h"
+
+// List iterator class templated definition
+template<class ItemType>
+class ListIterator {
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef ItemType value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef const ItemType* pointer;
+	typedef const ItemType& reference;
+
+	ListIterator();
+	explicit ListIterator(const Node<ItemType>* nodePtr);
+
+	reference operator*() const;
+	pointer operator->() const;
+	ListIterator<ItemType>& operator++();
+	ListIterator<ItemType> operator++(int);
+	bool operator==(const ListIterator<ItemType>& other) const;
+	bool operator!=(const ListIterator<ItemType>& other) const;
+
+private:
+	const Node<ItemType>* current;
+
+	void skipRemoved();
+};
+
+#include "ListIterator.cpp"
+#endif  // end LIST_ITERATOR_H
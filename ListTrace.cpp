@@ -0,0 +1,402 @@
+// Program Information /////////////////////////////////////////////////////
+/**
+ * @file ListTrace.cpp
+ *
+ * @brief Implementation file for list operation traces
+ *
+ * @details Implements ListTrace and ReplayReport.
+ *
+ *          Binary format, all integers little endian: the magic "LTRC", a
+ *          32 bit format version, a 64 bit record count, then 17 bytes per
+ *          record: 64 bit timestamp, 32 bit position, 32 bit payload size
+ *          and 8 bit operation
+ *
+ * @version 1.00
+ *
+ * @note requires ListTrace header file
+ */
+
+// Pre compiler directives ///////////////////////////////////////////////////
+
+	// none
+
+// Header Files /////////////////////////////////////////////////////////////
+#include "ListTrace.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+// File local helpers ///////////////////////////////////////////////////////
+namespace
+{
+	const char TRACE_MAGIC[4] = {'L', 'T', 'R', 'C'};
+	const std::uint32_t TRACE_VERSION = 1;
+
+	void writeUnsigned(std::ostream& out, std::uint64_t value, int byteCount)
+	{
+		for (int byte = 0; byte < byteCount; byte++)
+		{
+			out.put(static_cast<char>((value >> (8 * byte)) & 0xFF));
+		}
+	}
+
+	bool readUnsigned(std::istream& in, std::uint64_t& value, int byteCount)
+	{
+		value = 0;
+
+		for (int byte = 0; byte < byteCount; byte++)
+		{
+			int nextByte = in.get();
+
+			if (nextByte == std::char_traits<char>::eof())
+			{
+				return false;
+			}
+
+			value |= static_cast<std::uint64_t>(nextByte & 0xFF) << (8 * byte);
+		}
+
+		return true;
+	}
+}
+
+// Class/Data Structure member implementations ////////////////////////////////
+/**
+ * @brief Trace default constructor
+ *
+ * @details Creates an empty trace
+ *
+ * @pre none
+ *
+ * @post Initialized trace with no records
+ *
+ * @par none
+ *
+ * @return none
+ *
+ */
+ListTrace::ListTrace()
+{
+}
+
+/**
+ * @brief Checks if the trace has no records
+ *
+ * @return a boolean for an empty trace
+ *
+ */
+bool ListTrace::isEmpty() const
+{
+	return records.empty();
+}
+
+/**
+ * @brief Gets the number of records in the trace
+ *
+ * @return the number of records as an int
+ *
+ */
+int ListTrace::getLength() const
+{
+	return static_cast<int>(records.size());
+}
+
+/**
+ * @brief Appends a record to the trace
+ *
+ * @details none
+ *
+ * @pre none
+ *
+ * @post the record is the last one in the trace
+ *
+ * @par none
+ *
+ * @param[in] record is the operation to record
+ *
+ * @return none
+ *
+ */
+void ListTrace::addRecord(const ListTraceRecord& record)
+{
+	records.push_back(record);
+}
+
+/**
+ * @brief Gets the record at a position in the trace
+ *
+ * @details none
+ *
+ * @pre 1 <= position <= getLength()
+ *
+ * @post none
+ *
+ * @par none
+ *
+ * @param[in] position is the position of the record, starting at 1
+ *
+ * @return a const reference to the record
+ *
+ * @note uses the header cassert for debugging purposes
+ *
+ */
+const ListTraceRecord& ListTrace::getRecord(int position) const
+{
+	assert((position >= 1) && (position <= getLength()));
+
+	return records[position - 1];
+}
+
+/**
+ * @brief Removes every record from the trace
+ *
+ * @return none
+ *
+ */
+void ListTrace::clear()
+{
+	records.clear();
+}
+
+/**
+ * @brief Writes the trace in the binary trace format
+ *
+ * @details see the file comment for the layout
+ *
+ * @pre out is opened in binary mode
+ *
+ * @post the trace has been written to out
+ *
+ * @par Algorithm
+ *      Writes the header, then every record field by field in little endian
+ *
+ * @param[in] out is the stream to write to
+ *
+ * @return a boolean for whether the stream is still good afterwards
+ *
+ */
+bool ListTrace::save(std::ostream& out) const
+{
+	out.write(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+	writeUnsigned(out, TRACE_VERSION, 4);
+	writeUnsigned(out, records.size(), 8);
+
+	for (std::vector<ListTraceRecord>::size_type index = 0; index < records.size(); index++)
+	{
+		const ListTraceRecord& record = records[index];
+
+		writeUnsigned(out, record.timestamp, 8);
+		writeUnsigned(out, static_cast<std::uint32_t>(record.position), 4);
+		writeUnsigned(out, record.payloadSize, 4);
+		writeUnsigned(out, record.op, 1);
+	}
+
+	return out.good();
+}
+
+/**
+ * @brief Reads a trace in the binary trace format
+ *
+ * @details Replaces the records of this trace
+ *
+ * @pre in is opened in binary mode
+ *
+ * @post If the data is a valid trace, this trace holds its records;
+ *       otherwise this trace is unchanged
+ *
+ * @par Algorithm
+ *      Checks the header, then reads the records into a new buffer and
+ *      swaps it in once all of them were read
+ *
+ * @param[in] in is the stream to read from
+ *
+ * @return a boolean for whether a valid trace was read
+ *
+ */
+bool ListTrace::load(std::istream& in)
+{
+	char magic[sizeof(TRACE_MAGIC)];
+	std::uint64_t version = 0;
+	std::uint64_t recordCount = 0;
+
+	if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), TRACE_MAGIC)
+	    || !readUnsigned(in, version, 4) || version != TRACE_VERSION
+	    || !readUnsigned(in, recordCount, 8))
+	{
+		return false;
+	}
+
+	std::vector<ListTraceRecord> loaded;
+
+	for (std::uint64_t index = 0; index < recordCount; index++)
+	{
+		std::uint64_t timestamp, position, payloadSize, op;
+
+		if (!readUnsigned(in, timestamp, 8) || !readUnsigned(in, position, 4)
+		    || !readUnsigned(in, payloadSize, 4) || !readUnsigned(in, op, 1)
+		    || op > TRACE_CLEAR)
+		{
+			return false;
+		}
+
+		ListTraceRecord record;
+		record.timestamp = timestamp;
+		record.position = static_cast<std::int32_t>(static_cast<std::uint32_t>(position));
+		record.payloadSize = static_cast<std::uint32_t>(payloadSize);
+		record.op = static_cast<std::uint8_t>(op);
+		loaded.push_back(record);
+	}
+
+	records.swap(loaded);
+	return true;
+}
+
+/**
+ * @brief Report default constructor
+ *
+ * @details Creates the report of an empty replay
+ *
+ * @pre none
+ *
+ * @post Initialized report with no operations
+ *
+ * @par none
+ *
+ * @return none
+ *
+ */
+ReplayReport::ReplayReport()
+	: elapsed(0), failedCount(0)
+{
+}
+
+/**
+ * @brief Parameterized report constructor
+ *
+ * @details Summarizes the per operation latencies of a replay
+ *
+ * @pre none
+ *
+ * @post Initialized report with the latencies sorted for percentile lookups
+ *
+ * @par none
+ *
+ * @param[in] latencies holds the latency of each replayed operation in nanoseconds
+ *
+ * @param[in] elapsedNanoseconds is the wall time of the whole replay
+ *
+ * @param[in] failedOps is the number of operations the list rejected
+ *
+ * @return none
+ *
+ */
+ReplayReport::ReplayReport(const std::vector<std::uint64_t>& latencies,
+                           std::uint64_t elapsedNanoseconds, int failedOps)
+	: sortedLatencies(latencies), elapsed(elapsedNanoseconds), failedCount(failedOps)
+{
+	std::sort(sortedLatencies.begin(), sortedLatencies.end());
+}
+
+/**
+ * @brief Gets the number of operations replayed
+ *
+ * @return the number of operations as an int
+ *
+ */
+int ReplayReport::getOpCount() const
+{
+	return static_cast<int>(sortedLatencies.size());
+}
+
+/**
+ * @brief Gets the number of operations the list rejected
+ *
+ * @details Such as positions out of range for the replayed list
+ *
+ * @return the number of failed operations as an int
+ *
+ */
+int ReplayReport::getFailedOpCount() const
+{
+	return failedCount;
+}
+
+/**
+ * @brief Gets the wall time of the replay
+ *
+ * @return the elapsed time in nanoseconds
+ *
+ */
+std::uint64_t ReplayReport::getElapsedNanoseconds() const
+{
+	return elapsed;
+}
+
+/**
+ * @brief Gets the replay throughput
+ *
+ * @return operations per second, 0 for an empty replay
+ *
+ */
+double ReplayReport::getThroughput() const
+{
+	return (elapsed == 0) ? 0.0 : sortedLatencies.size() * 1.0e9 / elapsed;
+}
+
+/**
+ * @brief Gets a latency percentile
+ *
+ * @details Nearest rank: the smallest latency that at least percentile
+ *          percent of the operations did not exceed
+ *
+ * @pre 0 <= percentile <= 100
+ *
+ * @post none
+ *
+ * @par none
+ *
+ * @param[in] percentile is the percentile to look up, such as 50 or 99.9
+ *
+ * @return the latency in nanoseconds, 0 for an empty replay
+ *
+ */
+std::uint64_t ReplayReport::getLatencyPercentile(double percentile) const
+{
+	if (sortedLatencies.empty())
+	{
+		return 0;
+	}
+
+	double rank = std::ceil(percentile / 100.0 * sortedLatencies.size());
+	std::vector<std::uint64_t>::size_type index = (rank < 1.0) ? 0 :
+		static_cast<std::vector<std::uint64_t>::size_type>(rank) - 1;
+
+	return sortedLatencies[std::min(index, sortedLatencies.size() - 1)];
+}
+
+/**
+ * @brief Prints the report on one line
+ *
+ * @details Throughput, then p50, p90, p99, p99.9 and max latency
+ *
+ * @pre none
+ *
+ * @post the report has been written to out
+ *
+ * @par none
+ *
+ * @param[in] out is the stream to write to
+ *
+ * @return none
+ *
+ */
+void ReplayReport::print(std::ostream& out) const
+{
+	out << getOpCount() << " ops (" << failedCount << " failed) in "
+	    << elapsed / 1000 << " us, " << static_cast<std::uint64_t>(getThroughput()) << " ops/s, latency ns"
+	    << " p50=" << getLatencyPercentile(50)
+	    << " p90=" << getLatencyPercentile(90)
+	    << " p99=" << getLatencyPercentile(99)
+	    << " p99.9=" << getLatencyPercentile(99.9)
+	    << " max=" << getLatencyPercentile(100) << std::endl;
+}
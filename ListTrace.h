@@ -0,0 +1,82 @@
+// Program Information /////////////////////////////////////////////////////
+/**
+ * @file ListTrace.h
+ *
+ * @brief Header file for list operation traces
+ *
+ * @details A ListTrace is a compact record of the operations made on a list:
+ *          which operation, at which position, how large the payload was and
+ *          when it happened. TracingList captures traces and replayTrace()
+ *          runs them against any list; the replay results are summarized in
+ *          a ReplayReport
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives ////////////////////////////////////////////////
+#ifndef LIST_TRACE_H
+#define LIST_TRACE_H
+
+// Header Files ///////////////////////////////////////////////////////////
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+// Operation recorded by a ListTraceRecord
+enum ListTraceOp {
+	TRACE_INSERT,
+	TRACE_REMOVE,
+	TRACE_GET_ENTRY,
+	TRACE_REPLACE,
+	TRACE_CLEAR
+};
+
+// One traced operation
+struct ListTraceRecord {
+	std::uint64_t timestamp;   // nanoseconds since the trace started
+	std::int32_t position;
+	std::uint32_t payloadSize; // bytes of the item inserted or replaced
+	std::uint8_t op;           // a ListTraceOp
+};
+
+// List Trace Class Definition ////////////////////////////////////////////
+class ListTrace {
+public:
+	ListTrace();
+
+	// functions for the trace
+	bool isEmpty() const;
+	int getLength() const;
+	void addRecord(const ListTraceRecord& record);
+	const ListTraceRecord& getRecord(int position) const;
+	void clear();
+
+	// binary format
+	bool save(std::ostream& out) const;
+	bool load(std::istream& in);
+
+private:
+	std::vector<ListTraceRecord> records;
+};
+
+// Replay Report Class Definition /////////////////////////////////////////
+class ReplayReport {
+public:
+	ReplayReport();
+	ReplayReport(const std::vector<std::uint64_t>& latencies, std::uint64_t elapsedNanoseconds,
+	             int failedOps);
+
+	int getOpCount() const;
+	int getFailedOpCount() const;
+	std::uint64_t getElapsedNanoseconds() const;
+	double getThroughput() const;
+	std::uint64_t getLatencyPercentile(double percentile) const;
+	void print(std::ostream& out) const;
+
+private:
+	std::vector<std::uint64_t> sortedLatencies;
+	std::uint64_t elapsed;
+	int failedCount;
+};
+
+#endif // end LIST_TRACE_H
@@ -0,0 +1,712 @@
+// Program Information //////////////////////////////////////////////////////////
+/**
+ * @file ListView.cpp
+ *
+ * @brief Implementation file for lazy list views
+ *
+ * @details Implements the iterator adaptors, the ListView class and the view
+ *          factories. No adaptor allocates; work happens only as the final
+ *          view is iterated
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives /////////////////////////////////////////////////////
+#ifndef LIST_VIEW_CPP
+#define LIST_VIEW_CPP
+
+// Header Files ////////////////////////////////////////////////////////////////
+#include "ListView.h"
+
+// FilterIterator member implementations ///////////////////////////////////////
+/**
+ * @brief Filter iterator constructor
+ *
+ * @details The iterator is at the first entry from position onwards that
+ *          pred accepts; it only looks for it when first used
+ *
+ * @param[in] position is where to start in the underlying sequence
+ *
+ * @param[in] last is the end of the underlying sequence
+ *
+ * @param[in] pred is called as bool(entry) and returns true to keep it
+ *
+ * @return none
+ *
+ */
+template<class Iterator, class Predicate>
+FilterIterator<Iterator, Predicate> :: FilterIterator(Iterator position, Iterator last, Predicate pred)
+	: current(position), end(last), predicate(pred), settled(false)
+{
+}
+
+/**
+ * @brief Gets the entry the iterator is at
+ *
+ * @return the underlying entry
+ *
+ */
+template<class Iterator, class Predicate>
+typename FilterIterator<Iterator, Predicate>::reference FilterIterator<Iterator, Predicate> :: operator*() const
+{
+	skipRejected();
+	return *current;
+}
+
+/**
+ * @brief Moves to the next accepted entry
+ *
+ * @return this iterator
+ *
+ */
+template<class Iterator, class Predicate>
+FilterIterator<Iterator, Predicate>& FilterIterator<Iterator, Predicate> :: operator++()
+{
+	skipRejected();
+	++current;
+	settled = false;
+	return *this;
+}
+
+/**
+ * @brief Moves to the next accepted entry
+ *
+ * @return a copy of the iterator from before the move
+ *
+ */
+template<class Iterator, class Predicate>
+FilterIterator<Iterator, Predicate> FilterIterator<Iterator, Predicate> :: operator++(int)
+{
+	FilterIterator before = *this;
+	++(*this);
+	return before;
+}
+
+/**
+ * @brief Checks if two iterators are at the same underlying position
+ *
+ * @return true if the underlying iterators are equal
+ *
+ */
+template<class Iterator, class Predicate>
+bool FilterIterator<Iterator, Predicate> :: operator==(const FilterIterator& other) const
+{
+	skipRejected();
+	other.skipRejected();
+	return current == other.current;
+}
+
+/**
+ * @brief Checks if two iterators are at different underlying positions
+ *
+ * @return the opposite of operator==
+ *
+ */
+template<class Iterator, class Predicate>
+bool FilterIterator<Iterator, Predicate> :: operator!=(const FilterIterator& other) const
+{
+	return !(*this == other);
+}
+
+/**
+ * @brief Moves past the entries the predicate rejects
+ *
+ * @details Does nothing if the iterator has already settled on an entry
+ *
+ * @post the iterator is at an accepted entry or at the end
+ *
+ * @return none
+ *
+ */
+template<class Iterator, class Predicate>
+void FilterIterator<Iterator, Predicate> :: skipRejected() const
+{
+	if (!settled)
+	{
+		while (current != end && !predicate(*current))
+		{
+			++current;
+		}
+
+		settled = true;
+	}
+}
+
+// MapIterator member implementations //////////////////////////////////////////
+/**
+ * @brief Map iterator constructor
+ *
+ * @param[in] position is where to start in the underlying sequence
+ *
+ * @param[in] func is applied to each entry as it is read
+ *
+ * @return none
+ *
+ */
+template<class Iterator, class Function>
+MapIterator<Iterator, Function> :: MapIterator(Iterator position, Function func)
+	: current(position), function(func)
+{
+}
+
+/**
+ * @brief Gets the mapped entry
+ *
+ * @details func is called each time the iterator is dereferenced
+ *
+ * @return func applied to the underlying entry, by value
+ *
+ */
+template<class Iterator, class Function>
+typename MapIterator<Iterator, Function>::reference MapIterator<Iterator, Function> :: operator*() const
+{
+	return function(*current);
+}
+
+/**
+ * @brief Moves to the next entry
+ *
+ * @return this iterator
+ *
+ */
+template<class Iterator, class Function>
+MapIterator<Iterator, Function>& MapIterator<Iterator, Function> :: operator++()
+{
+	++current;
+	return *this;
+}
+
+/**
+ * @brief Moves to the next entry
+ *
+ * @return a copy of the iterator from before the move
+ *
+ */
+template<class Iterator, class Function>
+MapIterator<Iterator, Function> MapIterator<Iterator, Function> :: operator++(int)
+{
+	MapIterator before = *this;
+	++current;
+	return before;
+}
+
+/**
+ * @brief Checks if two iterators are at the same underlying position
+ *
+ * @return true if the underlying iterators are equal
+ *
+ */
+template<class Iterator, class Function>
+bool MapIterator<Iterator, Function> :: operator==(const MapIterator& other) const
+{
+	return current == other.current;
+}
+
+/**
+ * @brief Checks if two iterators are at different underlying positions
+ *
+ * @return the opposite of operator==
+ *
+ */
+template<class Iterator, class Function>
+bool MapIterator<Iterator, Function> :: operator!=(const MapIterator& other) const
+{
+	return !(*this == other);
+}
+
+// TakeIterator member implementations /////////////////////////////////////////
+/**
+ * @brief Default take iterator constructor
+ *
+ * @details Needed for the iterator to model the C++20 iterator concepts.
+ *          The default iterator has nothing left to take, so it is at the end
+ *
+ * @return none
+ *
+ */
+template<class Iterator>
+TakeIterator<Iterator> :: TakeIterator()
+	: current(), end(), remaining(0)
+{
+}
+
+/**
+ * @brief Take iterator constructor
+ *
+ * @param[in] position is where to start in the underlying sequence
+ *
+ * @param[in] last is the end of the underlying sequence
+ *
+ * @param[in] count is the most entries to visit
+ *
+ * @return none
+ *
+ */
+template<class Iterator>
+TakeIterator<Iterator> :: TakeIterator(Iterator position, Iterator last, int count)
+	: current(position), end(last), remaining(count)
+{
+}
+
+/**
+ * @brief Gets the entry the iterator is at
+ *
+ * @return the underlying entry
+ *
+ */
+template<class Iterator>
+typename TakeIterator<Iterator>::reference TakeIterator<Iterator> :: operator*() const
+{
+	return *current;
+}
+
+/**
+ * @brief Moves to the next entry
+ *
+ * @return this iterator
+ *
+ */
+template<class Iterator>
+TakeIterator<Iterator>& TakeIterator<Iterator> :: operator++()
+{
+	++current;
+	remaining--;
+	return *this;
+}
+
+/**
+ * @brief Moves to the next entry
+ *
+ * @return a copy of the iterator from before the move
+ *
+ */
+template<class Iterator>
+TakeIterator<Iterator> TakeIterator<Iterator> :: operator++(int)
+{
+	TakeIterator before = *this;
+	++(*this);
+	return before;
+}
+
+/**
+ * @brief Checks if two iterators are at the same position
+ *
+ * @details Every exhausted iterator equals every other one, so the end of a
+ *          take() is reached by running out of count or of entries
+ *
+ * @return true if both are at the end, or at the same position with the
+ *         same count left
+ *
+ */
+template<class Iterator>
+bool TakeIterator<Iterator> :: operator==(const TakeIterator& other) const
+{
+	bool thisAtEnd = atEnd();
+	bool otherAtEnd = other.atEnd();
+
+	if (thisAtEnd || otherAtEnd)
+	{
+		return thisAtEnd && otherAtEnd;
+	}
+
+	return current == other.current && remaining == other.remaining;
+}
+
+/**
+ * @brief Checks if two iterators are at different positions
+ *
+ * @return the opposite of operator==
+ *
+ */
+template<class Iterator>
+bool TakeIterator<Iterator> :: operator!=(const TakeIterator& other) const
+{
+	return !(*this == other);
+}
+
+/**
+ * @brief Checks if the count or the entries have run out
+ *
+ * @return true if the iterator is exhausted
+ *
+ */
+template<class Iterator>
+bool TakeIterator<Iterator> :: atEnd() const
+{
+	return remaining <= 0 || current == end;
+}
+
+// ZipIterator member implementations //////////////////////////////////////////
+/**
+ * @brief Default zip iterator constructor
+ *
+ * @details Needed for the iterator to model the C++20 iterator concepts.
+ *          Both sequences are value initialized, so when their default
+ *          iterators compare equal, as ListIterator's do, it is at the end
+ *
+ * @return none
+ *
+ */
+template<class FirstIterator, class SecondIterator>
+ZipIterator<FirstIterator, SecondIterator> :: ZipIterator()
+	: firstCurrent(), firstEnd(), secondCurrent(), secondEnd()
+{
+}
+
+/**
+ * @brief Zip iterator constructor
+ *
+ * @param[in] firstPosition is where to start in the first sequence
+ *
+ * @param[in] firstLast is the end of the first sequence
+ *
+ * @param[in] secondPosition is where to start in the second sequence
+ *
+ * @param[in] secondLast is the end of the second sequence
+ *
+ * @return none
+ *
+ */
+template<class FirstIterator, class SecondIterator>
+ZipIterator<FirstIterator, SecondIterator> :: ZipIterator(FirstIterator firstPosition, FirstIterator firstLast,
+                                                          SecondIterator secondPosition, SecondIterator secondLast)
+	: firstCurrent(firstPosition), firstEnd(firstLast),
+	  secondCurrent(secondPosition), secondEnd(secondLast)
+{
+}
+
+/**
+ * @brief Gets the pair of entries the iterator is at
+ *
+ * @return a pair holding copies of both entries
+ *
+ */
+template<class FirstIterator, class SecondIterator>
+typename ZipIterator<FirstIterator, SecondIterator>::reference
+ZipIterator<FirstIterator, SecondIterator> :: operator*() const
+{
+	return value_type(*firstCurrent, *secondCurrent);
+}
+
+/**
+ * @brief Moves both sequences to their next entries
+ *
+ * @return this iterator
+ *
+ */
+template<class FirstIterator, class SecondIterator>
+ZipIterator<FirstIterator, SecondIterator>& ZipIterator<FirstIterator, SecondIterator> :: operator++()
+{
+	++firstCurrent;
+	++secondCurrent;
+	return *this;
+}
+
+/**
+ * @brief Moves both sequences to their next entries
+ *
+ * @return a copy of the iterator from before the move
+ *
+ */
+template<class FirstIterator, class SecondIterator>
+ZipIterator<FirstIterator, SecondIterator> ZipIterator<FirstIterator, SecondIterator> :: operator++(int)
+{
+	ZipIterator before = *this;
+	++(*this);
+	return before;
+}
+
+/**
+ * @brief Checks if two iterators are at the same positions
+ *
+ * @details Every exhausted iterator equals every other one, so the end is
+ *          reached when either sequence runs out
+ *
+ * @return true if both are at the end, or at the same positions
+ *
+ */
+template<class FirstIterator, class SecondIterator>
+bool ZipIterator<FirstIterator, SecondIterator> :: operator==(const ZipIterator& other) const
+{
+	bool thisAtEnd = atEnd();
+	bool otherAtEnd = other.atEnd();
+
+	if (thisAtEnd || otherAtEnd)
+	{
+		return thisAtEnd && otherAtEnd;
+	}
+
+	return firstCurrent == other.firstCurrent && secondCurrent == other.secondCurrent;
+}
+
+/**
+ * @brief Checks if two iterators are at different positions
+ *
+ * @return the opposite of operator==
+ *
+ */
+template<class FirstIterator, class SecondIterator>
+bool ZipIterator<FirstIterator, SecondIterator> :: operator!=(const ZipIterator& other) const
+{
+	return !(*this == other);
+}
+
+/**
+ * @brief Checks if either sequence has run out
+ *
+ * @return true if the iterator is exhausted
+ *
+ */
+template<class FirstIterator, class SecondIterator>
+bool ZipIterator<FirstIterator, SecondIterator> :: atEnd() const
+{
+	return firstCurrent == firstEnd || secondCurrent == secondEnd;
+}
+
+// ListView member implementations /////////////////////////////////////////////
+/**
+ * @brief List view constructor
+ *
+ * @details The view does not own or copy the entries
+ *
+ * @pre [first, last) is a valid range
+ *
+ * @post Creates a view of the range
+ *
+ * @param[in] first is the start of the range
+ *
+ * @param[in] last is the end of the range
+ *
+ * @return none
+ *
+ */
+template<class Iterator>
+ListView<Iterator> :: ListView(Iterator first, Iterator last)
+	: firstPosition(first), lastPosition(last)
+{
+}
+
+/**
+ * @brief Gets an iterator at the start of the view
+ *
+ * @return the begin iterator
+ *
+ */
+template<class Iterator>
+Iterator ListView<Iterator> :: begin() const
+{
+	return firstPosition;
+}
+
+/**
+ * @brief Gets an iterator at the end of the view
+ *
+ * @return the end iterator
+ *
+ */
+template<class Iterator>
+Iterator ListView<Iterator> :: end() const
+{
+	return lastPosition;
+}
+
+/**
+ * @brief Checks if the view has no entries
+ *
+ * @details For a filter() view this evaluates the predicate up to the first
+ *          accepted entry
+ *
+ * @return a boolean for an empty view
+ *
+ */
+template<class Iterator>
+bool ListView<Iterator> :: isEmpty() const
+{
+	return !(firstPosition != lastPosition);
+}
+
+/**
+ * @brief Views only the entries a predicate accepts
+ *
+ * @details Lazy; pred runs while the new view is iterated
+ *
+ * @pre pred can be called as bool(const value_type&)
+ *
+ * @post none, no entry is visited
+ *
+ * @param[in] pred returns true for the entries to keep
+ *
+ * @return the filtered view
+ *
+ */
+template<class Iterator>
+template<class Predicate>
+ListView<FilterIterator<Iterator, Predicate> > ListView<Iterator> :: filter(Predicate pred) const
+{
+	typedef FilterIterator<Iterator, Predicate> Filtered;
+
+	return ListView<Filtered>(Filtered(firstPosition, lastPosition, pred),
+	                          Filtered(lastPosition, lastPosition, pred));
+}
+
+/**
+ * @brief Views every entry transformed by a function
+ *
+ * @details Lazy; func runs each time an entry of the new view is read
+ *
+ * @pre func can be called on a const value_type&
+ *
+ * @post none, no entry is visited
+ *
+ * @param[in] func computes the new entry from an entry of this view
+ *
+ * @return the mapped view
+ *
+ */
+template<class Iterator>
+template<class Function>
+ListView<MapIterator<Iterator, Function> > ListView<Iterator> :: map(Function func) const
+{
+	typedef MapIterator<Iterator, Function> Mapped;
+
+	return ListView<Mapped>(Mapped(firstPosition, func), Mapped(lastPosition, func));
+}
+
+/**
+ * @brief Views at most the first count entries
+ *
+ * @details Lazy; iteration stops after count entries, so the rest of the
+ *          chain and any earlier filter() are never evaluated past that point
+ *
+ * @pre none
+ *
+ * @post none, no entry is visited
+ *
+ * @param[in] count is the most entries to keep
+ *
+ * @return the truncated view
+ *
+ */
+template<class Iterator>
+ListView<TakeIterator<Iterator> > ListView<Iterator> :: take(int count) const
+{
+	typedef TakeIterator<Iterator> Taken;
+
+	return ListView<Taken>(Taken(firstPosition, lastPosition, count),
+	                       Taken(lastPosition, lastPosition, 0));
+}
+
+/**
+ * @brief Views pairs of entries from this view and another
+ *
+ * @details Lazy; the new view is as long as the shorter of the two
+ *
+ * @pre none
+ *
+ * @post none, no entry is visited
+ *
+ * @param[in] other is the view that supplies the second entry of each pair
+ *
+ * @return the zipped view
+ *
+ */
+template<class Iterator>
+template<class OtherIterator>
+ListView<ZipIterator<Iterator, OtherIterator> > ListView<Iterator> :: zip(const ListView<OtherIterator>& other) const
+{
+	typedef ZipIterator<Iterator, OtherIterator> Zipped;
+
+	return ListView<Zipped>(Zipped(firstPosition, lastPosition, other.begin(), other.end()),
+	                        Zipped(lastPosition, lastPosition, other.end(), other.end()));
+}
+
+/**
+ * @brief Evaluates the view into a new list
+ *
+ * @details The only step of a view chain that allocates nodes. The result
+ *          is moved out, so its nodes are never copied
+ *
+ * @pre none
+ *
+ * @post none, the viewed list is not modified
+ *
+ * @par Algorithm
+ *      Runs the whole adaptor chain in one pass through insertRange()
+ *
+ * @return a new list holding the entries of the view
+ *
+ */
+template<class Iterator>
+LinkedList<typename ListView<Iterator>::value_type> ListView<Iterator> :: toList() const
+{
+	LinkedList<value_type> result;
+	result.insertRange(1, firstPosition, lastPosition);
+	return result;
+}
+
+// View factory implementations ////////////////////////////////////////////////
+/**
+ * @brief Views a whole list
+ *
+ * @details O(1), no node is visited or copied
+ *
+ * @param[in] list is the list to view
+ *
+ * @return a view of every entry of the list
+ *
+ */
+template<class ItemType>
+ListView<ListIterator<ItemType> > makeView(const LinkedList<ItemType>& list)
+{
+	return ListView<ListIterator<ItemType> >(list.begin(), list.end());
+}
+
+/**
+ * @brief Views the entries between two positions of a list
+ *
+ * @details No node is copied. Finding the first entry walks fromPosition - 1
+ *          links, like getEntry(); the length of the slice costs nothing
+ *
+ * @pre none
+ *
+ * @post none
+ *
+ * @par Algorithm
+ *      Advances an iterator to fromPosition and takes the entries up to
+ *      toPosition from there
+ *
+ * @param[in] list is the list to view
+ *
+ * @param[in] fromPosition is the position of the first entry, starting at 1
+ *
+ * @param[in] toPosition is the position of the last entry, inclusive
+ *
+ * @return a view of entries fromPosition to toPosition, or an empty view if
+ *         1 <= fromPosition <= toPosition <= getLength() does not hold
+ *
+ */
+template<class ItemType>
+ListView<TakeIterator<ListIterator<ItemType> > > slice(const LinkedList<ItemType>& list,
+                                                       int fromPosition, int toPosition)
+{
+	typedef TakeIterator<ListIterator<ItemType> > Sliced;
+
+	bool ableToSlice = (fromPosition >= 1) && (fromPosition <= toPosition)
+	                   && (toPosition <= list.getLength());
+	ListIterator<ItemType> first = list.begin();
+
+	if (!ableToSlice)
+	{
+		return ListView<Sliced>(Sliced(list.end(), list.end(), 0), Sliced(list.end(), list.end(), 0));
+	}
+
+	for (int position = 1; position < fromPosition; position++)
+	{
+		++first;
+	}
+
+	return ListView<Sliced>(Sliced(first, list.end(), toPosition - fromPosition + 1),
+	                        Sliced(list.end(), list.end(), 0));
+}
+
+#endif // end LIST_VIEW_CPP
@@ -0,0 +1,181 @@
+// Program Information /////////////////////////////////////////////////////
+/**
+ * @file ListView.h
+ *
+ * @brief Header file for lazy list views
+ *
+ * @details A ListView is a non-owning pair of iterators over a LinkedList.
+ *          filter(), map(), take() and zip() return new views that wrap the
+ *          iterators instead of building lists, so a chain of them runs as
+ *          one fused pass when it is iterated or materialized with toList().
+ *          slice() views part of a list without copying any node.
+ *
+ *          Views refer to the nodes of their list; they must not outlive it
+ *          or be used across a remove, clear or compaction of it
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives ////////////////////////////////////////////////
+#ifndef LIST_VIEW_H
+#define LIST_VIEW_H
+
+// Header Files ///////////////////////////////////////////////////////////
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "LinkedList.h"
+#include "ListIterator.h"
+
+// Iterator adaptor definitions ///////////////////////////////////////////
+// visits only the entries pred accepts
+template<class Iterator, class Predicate>
+class FilterIterator {
+public:
+	typedef typename std::iterator_traits<Iterator>::iterator_category iterator_category;
+	typedef typename std::iterator_traits<Iterator>::value_type value_type;
+	typedef typename std::iterator_traits<Iterator>::difference_type difference_type;
+	typedef typename std::iterator_traits<Iterator>::pointer pointer;
+	typedef typename std::iterator_traits<Iterator>::reference reference;
+
+	FilterIterator(Iterator position, Iterator last, Predicate pred);
+
+	reference operator*() const;
+	FilterIterator& operator++();
+	FilterIterator operator++(int);
+	bool operator==(const FilterIterator& other) const;
+	bool operator!=(const FilterIterator& other) const;
+
+private:
+	// moved to the first accepted entry on first use, so building a
+	// filter() view does not evaluate the predicate
+	mutable Iterator current;
+	Iterator end;
+	Predicate predicate;
+	mutable bool settled;
+
+	void skipRejected() const;
+};
+
+// yields func applied to each entry
+template<class Iterator, class Function>
+class MapIterator {
+public:
+	typedef std::input_iterator_tag iterator_category;
+	typedef typename std::decay<decltype(std::declval<const Function&>()(
+		*std::declval<Iterator>()))>::type value_type;
+	typedef typename std::iterator_traits<Iterator>::difference_type difference_type;
+	typedef const value_type* pointer;
+	typedef value_type reference;
+
+	MapIterator(Iterator position, Function func);
+
+	reference operator*() const;
+	MapIterator& operator++();
+	MapIterator operator++(int);
+	bool operator==(const MapIterator& other) const;
+	bool operator!=(const MapIterator& other) const;
+
+private:
+	Iterator current;
+	Function function;
+};
+
+// stops after a number of entries or at the end, whichever comes first
+template<class Iterator>
+class TakeIterator {
+public:
+	typedef typename std::iterator_traits<Iterator>::iterator_category iterator_category;
+	typedef typename std::iterator_traits<Iterator>::value_type value_type;
+	typedef typename std::iterator_traits<Iterator>::difference_type difference_type;
+	typedef typename std::iterator_traits<Iterator>::pointer pointer;
+	typedef typename std::iterator_traits<Iterator>::reference reference;
+
+	TakeIterator();
+	TakeIterator(Iterator position, Iterator last, int count);
+
+	reference operator*() const;
+	TakeIterator& operator++();
+	TakeIterator operator++(int);
+	bool operator==(const TakeIterator& other) const;
+	bool operator!=(const TakeIterator& other) const;
+
+private:
+	Iterator current;
+	Iterator end;
+	int remaining;
+
+	bool atEnd() const;
+};
+
+// yields pairs of entries from two sequences, stopping at the shorter one
+template<class FirstIterator, class SecondIterator>
+class ZipIterator {
+public:
+	typedef std::input_iterator_tag iterator_category;
+	typedef std::pair<typename std::iterator_traits<FirstIterator>::value_type,
+	                  typename std::iterator_traits<SecondIterator>::value_type> value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef const value_type* pointer;
+	typedef value_type reference;
+
+	ZipIterator();
+	ZipIterator(FirstIterator firstPosition, FirstIterator firstLast,
+	            SecondIterator secondPosition, SecondIterator secondLast);
+
+	reference operator*() const;
+	ZipIterator& operator++();
+	ZipIterator operator++(int);
+	bool operator==(const ZipIterator& other) const;
+	bool operator!=(const ZipIterator& other) const;
+
+private:
+	FirstIterator firstCurrent;
+	FirstIterator firstEnd;
+	SecondIterator secondCurrent;
+	SecondIterator secondEnd;
+
+	bool atEnd() const;
+};
+
+// List View Templated Class Definition ///////////////////////////////////
+template<class Iterator>
+class ListView {
+public:
+	typedef Iterator iterator;
+	typedef Iterator const_iterator;
+	typedef typename std::iterator_traits<Iterator>::value_type value_type;
+
+	ListView(Iterator first, Iterator last);
+
+	Iterator begin() const;
+	Iterator end() const;
+	bool isEmpty() const;
+
+	// lazy adaptors, each returns a new view without visiting any entry
+	template<class Predicate>
+	ListView<FilterIterator<Iterator, Predicate> > filter(Predicate pred) const;
+	template<class Function>
+	ListView<MapIterator<Iterator, Function> > map(Function func) const;
+	ListView<TakeIterator<Iterator> > take(int count) const;
+	template<class OtherIterator>
+	ListView<ZipIterator<Iterator, OtherIterator> > zip(const ListView<OtherIterator>& other) const;
+
+	// evaluates the view in one pass into a new list
+	LinkedList<value_type> toList() const;
+
+private:
+	Iterator firstPosition;
+	Iterator lastPosition;
+};
+
+// View factories /////////////////////////////////////////////////////////
+template<class ItemType>
+ListView<ListIterator<ItemType> > makeView(const LinkedList<ItemType>& list);
+
+template<class ItemType>
+ListView<TakeIterator<ListIterator<ItemType> > > slice(const LinkedList<ItemType>& list,
+                                                       int fromPosition, int toPosition);
+
+#include "ListView.cpp"
+#endif // end LIST_VIEW_H
@@ -22,6 +22,9 @@
 // Header Files //////////////////////////////////////////////////////////////
 #include "Node.h"
 
+template<class ItemType>
+const std::uintptr_t Node<ItemType> :: REMOVED_BIT;
+
 /**
  * @brief Default node constructor with the next pointer set to null
  *
@@ -32,13 +35,13 @@
  * @post Creates a node with the bare minimum defaults, sets next pointer
  *
  * @par Algorithm
- *      Sets the next private member function to nullptr
+ *      Sets the next link to nullptr with the tombstone flag clear
  *
  * @return none
  *
  */
 template<class ItemType>
-Node<ItemType> :: Node() : next(nullptr)
+Node<ItemType> :: Node() : nextLink(0)
 {
 }
 
@@ -61,7 +64,7 @@ Node<ItemType> :: Node() : next(nullptr)
  */
 template<class ItemType>
 Node<ItemType> :: Node(const ItemType& data)
-	: item(data), next(nullptr)
+	: item(data), nextLink(0)
 {
 }
 
@@ -87,7 +90,7 @@ Node<ItemType> :: Node(const ItemType& data)
  */
 template<class ItemType>
 Node<ItemType> :: Node(const ItemType& data, Node<ItemType>* nextNodePtr)
-	: item(data), next(nextNodePtr)
+	: item(data), nextLink(reinterpret_cast<std::uintptr_t>(nextNodePtr))
 {
 }
 
@@ -120,7 +123,7 @@ void Node<ItemType> :: setItem(const ItemType& data)
  *
  * @pre none
  *
- * @post Assigns nextNodePtr to the next pointer
+ * @post Assigns nextNodePtr to the next pointer, keeping the tombstone flag
  *
  * @par none
  *
@@ -132,7 +135,7 @@ void Node<ItemType> :: setItem(const ItemType& data)
 template<class ItemType>
 void Node<ItemType> :: setNext(Node<ItemType>* nextNodePtr)
 {
-	next = nextNodePtr;
+	nextLink = reinterpret_cast<std::uintptr_t>(nextNodePtr) | (nextLink & REMOVED_BIT);
 }
 
 /**
@@ -155,6 +158,47 @@ ItemType Node<ItemType> :: getItem() const
 	return item;
 }
 
+/**
+ * @brief Gets a reference to the item in the node
+ *
+ * @details Avoids the copy made by getItem() so callers can read or
+ *          modify the item in place
+ *
+ * @pre none
+ *
+ * @post returns a reference to the item at the node
+ *
+ * @par none
+ *
+ * @return a reference to the item
+ *
+ */
+template<class ItemType>
+ItemType& Node<ItemType> :: getItemRef()
+{
+	return item;
+}
+
+/**
+ * @brief Gets a read only reference to the item in the node
+ *
+ * @details none
+ *
+ * @pre none
+ *
+ * @post returns a const reference to the item at the node
+ *
+ * @par none
+ *
+ * @return a const reference to the item
+ *
+ */
+template<class ItemType>
+const ItemType& Node<ItemType> :: getItemRef() const
+{
+	return item;
+}
+
 /**
   * @brief Gets the next node pointer
   *
@@ -166,13 +210,56 @@ ItemType Node<ItemType> :: getItem() const
   *
   * @par none
   *
-  * @return the private member next
+  * @return the next link with the tombstone flag masked off
   *
   */
 template<class ItemType>
 Node<ItemType>* Node<ItemType> :: getNext() const
 {
-	return next;
+	return reinterpret_cast<Node<ItemType>*>(nextLink & ~REMOVED_BIT);
+}
+
+/**
+ * @brief Marks or unmarks the node as a tombstone
+ *
+ * @details A tombstoned node is still linked but no longer part of the list.
+ *          The flag is the low bit of the next link, so it costs no space
+ *
+ * @pre none
+ *
+ * @post the removed flag is set to isRemovedNode
+ *
+ * @par none
+ *
+ * @param[in] isRemovedNode is true to tombstone the node
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void Node<ItemType> :: setRemoved(bool isRemovedNode)
+{
+	nextLink = isRemovedNode ? (nextLink | REMOVED_BIT) : (nextLink & ~REMOVED_BIT);
+}
+
+/**
+ * @brief Checks if the node is a tombstone
+ *
+ * @details none
+ *
+ * @pre none
+ *
+ * @post none
+ *
+ * @par none
+ *
+ * @return the tombstone flag
+ *
+ */
+template<class ItemType>
+bool Node<ItemType> :: isRemoved() const
+{
+	return (nextLink & REMOVED_BIT) != 0;
 }
 
 #endif // end NODE_CPP
@@ -21,8 +21,11 @@
 #define NODE_H
 
 // Header Files
+#include <cstdint>
 
-	// none
+// the tombstone flag lives in the low bit of the next link, which is free
+// because nodes are at least as aligned as the link itself
+static_assert(alignof(std::uintptr_t) >= 2, "Node needs a spare low bit in its next link");
 
 // Node class templated definition
 template<class ItemType>
@@ -34,11 +37,17 @@ public:
 	void setItem(const ItemType& data);
 	void setNext(Node<ItemType>* nextNodePtr);
 	ItemType getItem() const;
+	ItemType& getItemRef();
+	const ItemType& getItemRef() const;
 	Node<ItemType>* getNext() const;
+	void setRemoved(bool isRemovedNode);
+	bool isRemoved() const;
 
 private:
+	static const std::uintptr_t REMOVED_BIT = 1;
+
 	ItemType item;
-	Node<ItemType>* next;
+	std::uintptr_t nextLink; // next node pointer, tombstone flag in the low bit
 };
 
 #include "Node.cpp"
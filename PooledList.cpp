@@ -0,0 +1,510 @@
+// Program Information //////////////////////////////////////////////////////////
+/**
+ * @file PooledList.cpp
+ *
+ * @brief Implementation file for the pooled Linked List
+ *
+ * @details Implements all functions and methods defined by the PooledList class.
+ *          Removed nodes go on a free chain inside the pool and are reused by
+ *          later insertions. A removed node's item is swapped with a default
+ *          constructed one, so memory the item owned is released at once
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives /////////////////////////////////////////////////////
+#ifndef POOLED_LIST_CPP
+#define POOLED_LIST_CPP
+
+// Header Files ////////////////////////////////////////////////////////////////
+#include "PrecondViolatedExcep.h"
+#include "PooledList.h"
+#include <cassert>
+#include <utility>
+
+// Class/Data Structure member implementations /////////////////////////////////
+template<class ItemType>
+const std::uint32_t PooledList<ItemType> :: NO_NODE;
+
+/**
+ * @brief Pooled list default constructor
+ *
+ * @details Creates an empty list with an empty pool
+ *
+ * @pre Unintialized PooledList
+ *
+ * @post Initialized PooledList with no head, no free nodes and 0 itemcount
+ *
+ * @par Algorithm
+ *      Initializes the indices with the initializers
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+PooledList<ItemType> :: PooledList()
+	: headIndex(NO_NODE), freeIndex(NO_NODE), itemCount(0)
+{
+}
+
+/**
+ * @brief Destructor for the pooled list class
+ *
+ * @details The pool releases all nodes at once when it is destroyed
+ *
+ * @pre none
+ *
+ * @post All nodes are deallocated
+ *
+ * @par none
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+PooledList<ItemType> :: ~PooledList()
+{
+}
+
+/**
+ * @brief Checks if the list is empty
+ *
+ * @details Uses the itemCount to determine if the list is empty
+ *
+ * @pre none
+ *
+ * @post determines if the itemCount is 0 or not
+ *
+ * @par none
+ *
+ * @return a boolean for an empty list
+ *
+ */
+template<class ItemType>
+bool PooledList<ItemType> :: isEmpty() const
+{
+	return itemCount == 0;
+}
+
+/**
+ * @brief Gets the length of the List using its item count
+ *
+ * @details none
+ *
+ * @pre none
+ *
+ * @post determines the number of items in the list
+ *
+ * @par none
+ *
+ * @return itemCount as an int; the number of items in the list
+ *
+ */
+template<class ItemType>
+int PooledList<ItemType> :: getLength() const
+{
+	return itemCount;
+}
+
+/**
+ * @brief Inserts a new node at some position with some data in the list
+ *
+ * @details Reuses a node from the free chain when there is one, otherwise
+ *          appends a new node to the pool
+ *
+ * @pre none
+ *
+ * @post If 1 <= newPosition <= getLength() + 1, newEntry is at that position
+ *       and later entries are renumbered
+ *
+ * @par Algorithm
+ *      Takes a free node, stores the data in it and links it after the node
+ *      before newPosition, or at the head for position 1
+ *
+ * @exception none, other than allocation failure when the pool grows
+ *
+ * @param[in] newPosition is where the node will be inserted in this list
+ *
+ * @param[in] newEntry is the item to be inserted into the list
+ *
+ * @return a boolean logic if the insertion could be done or not; false as
+ *         well when the pool has run out of 32 bit indices
+ *
+ */
+template<class ItemType>
+bool PooledList<ItemType> :: insert(int newPosition, const ItemType& newEntry)
+{
+	bool ableToInsert = (newPosition >= 1) && (newPosition <= itemCount + 1)
+	                    && (freeIndex != NO_NODE || pool.size() < NO_NODE);
+
+	if (ableToInsert)
+	{
+		// take a node from the free chain or grow the pool
+		std::uint32_t newIndex;
+
+		if (freeIndex != NO_NODE)
+		{
+			newIndex = freeIndex;
+			freeIndex = pool[newIndex].next;
+			pool[newIndex].item = newEntry;
+		}
+
+		else
+		{
+			PoolNode newNode = {newEntry, NO_NODE};
+			newIndex = static_cast<std::uint32_t>(pool.size());
+			pool.push_back(newNode);
+		}
+
+		// attach new node
+		if (newPosition == 1)
+		{
+			pool[newIndex].next = headIndex;
+			headIndex = newIndex;
+		}
+
+		else
+		{
+			std::uint32_t prevIndex = getNodeIndexAt(newPosition - 1);
+			pool[newIndex].next = pool[prevIndex].next;
+			pool[prevIndex].next = newIndex;
+		}
+
+		itemCount++;
+	}
+
+	return ableToInsert;
+}
+
+/**
+ * @brief Removes a node from the list
+ *
+ * @details The node goes on the free chain holding a default constructed
+ *          item; the removed item is destroyed, releasing any memory it owns
+ *
+ * @pre none
+ *
+ * @post If 1 <= position <= getLength(), the entry at that position is removed
+ *       and later entries are renumbered
+ *
+ * @par Algorithm
+ *      Unlinks the node at the position, swaps its item with a default
+ *      constructed one and pushes it on the free chain
+ *
+ * @exception none
+ *
+ * @param[in] position is where the node will be removed from
+ *
+ * @return A booleon for successful removal or not
+ *
+ */
+template<class ItemType>
+bool PooledList<ItemType> :: remove(int position)
+{
+	bool ableToRemove = (position >= 1) && (position <= itemCount);
+
+	if (ableToRemove)
+	{
+		std::uint32_t currentIndex;
+
+		if (position == 1)
+		{
+			currentIndex = headIndex;
+			headIndex = pool[currentIndex].next;
+		}
+
+		else
+		{
+			std::uint32_t prevIndex = getNodeIndexAt(position - 1);
+			currentIndex = pool[prevIndex].next;
+			pool[prevIndex].next = pool[currentIndex].next;
+		}
+
+		// release the item's payload, then return the node to the free chain
+		ItemType releasedItem = ItemType();
+		using std::swap;
+		swap(pool[currentIndex].item, releasedItem);
+
+		pool[currentIndex].next = freeIndex;
+		freeIndex = currentIndex;
+
+		itemCount--;
+	}
+
+	return ableToRemove;
+}
+
+/**
+ * @brief Clears the list and releases the nodes
+ *
+ * @details The pool keeps its capacity; memoryUsage() still counts it
+ *
+ * @pre none
+ *
+ * @post the list is empty
+ *
+ * @par Algorithm
+ *      Destroys every node in the pool at once and resets the indices
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void PooledList<ItemType> :: clear()
+{
+	pool.clear();
+	headIndex = NO_NODE;
+	freeIndex = NO_NODE;
+	itemCount = 0;
+}
+
+/**
+ * @brief Gets the entry at some position entered by user
+ *
+ * @details uses an exception if the position is not in the list
+ *
+ * @pre none
+ *
+ * @post Returns the data or throws an exception for an invalid position
+ *
+ * @par Algorithm
+ *      If the position is within bounds, return the item of that node
+ *      otherwise, throw an exception for invalid position
+ *
+ * @exception PrecondViolatedExcep if the position is outside the list
+ *
+ * @param[in] position is where the method will attempt to retrieve the data
+ *
+ * @return a copy of the data at the position
+ *
+ */
+template<class ItemType>
+ItemType PooledList<ItemType> :: getEntry(int position) const
+{
+	bool ableToGet = (position >= 1) && (position <= itemCount);
+
+	if (!ableToGet)
+	{
+		throw(PrecondViolatedExcept("getEntry() called with an empty list or invalid position."));
+	}
+
+	return pool[getNodeIndexAt(position)].item;
+}
+
+/**
+ * @brief Replaces old data with new data at the given position
+ *
+ * @details May throw an exception error if out of bounds
+ *
+ * @pre none
+ *
+ * @post The entry at the given position is newEntry
+ *
+ * @par Algorithm
+ *      Gets the node at the position and sets its item to the new entry
+ *
+ * @exception PrecondViolatedExcep if the position is outside the list
+ *
+ * @param[in] position is the location in the list for where the item is to be replaced
+ *
+ * @param[in] newEntry is the replacement item
+ *
+ * @return the entry now at the position, as LinkedList::replace() does
+ *
+ */
+template<class ItemType>
+ItemType PooledList<ItemType> :: replace(int position, const ItemType& newEntry)
+{
+	bool ableToSet = (position >= 1) && (position <= itemCount);
+
+	if (!ableToSet)
+	{
+		throw(PrecondViolatedExcept("replace() called with an empty list or invalid position."));
+	}
+
+	PoolNode& node = pool[getNodeIndexAt(position)];
+	node.item = newEntry;
+	return node.item;
+}
+
+/**
+ * @brief Gets the entry at some position without throwing
+ *
+ * @details See LinkedList::tryGetEntry()
+ *
+ * @pre none
+ *
+ * @post If the position is valid, entry holds a copy of the data at that position
+ *
+ * @par none
+ *
+ * @exception none; noexcept whenever copying an ItemType cannot throw
+ *
+ * @param[in] position is where the method will attempt to retrieve the data
+ *
+ * @param[out] entry receives the data at the given position
+ *
+ * @return a boolean logic if the entry was retrieved or not
+ *
+ */
+template<class ItemType>
+bool PooledList<ItemType> :: tryGetEntry(int position, ItemType& entry) const
+	noexcept(std::is_nothrow_copy_assignable<ItemType>::value)
+{
+	bool ableToGet = (position >= 1) && (position <= itemCount);
+
+	if (ableToGet)
+	{
+		entry = pool[getNodeIndexAt(position)].item;
+	}
+
+	return ableToGet;
+}
+
+/**
+ * @brief Replaces the entry at some position without throwing
+ *
+ * @details See LinkedList::tryReplace()
+ *
+ * @pre none
+ *
+ * @post If the position is valid, the entry at that position is newEntry
+ *
+ * @par none
+ *
+ * @exception none; noexcept whenever copying an ItemType cannot throw
+ *
+ * @param[in] position is the location in the list for where the item is to be replaced
+ *
+ * @param[in] newEntry is the replacement item
+ *
+ * @return a boolean logic if the replacement could be done or not
+ *
+ */
+template<class ItemType>
+bool PooledList<ItemType> :: tryReplace(int position, const ItemType& newEntry)
+	noexcept(std::is_nothrow_copy_assignable<ItemType>::value)
+{
+	bool ableToSet = (position >= 1) && (position <= itemCount);
+
+	if (ableToSet)
+	{
+		pool[getNodeIndexAt(position)].item = newEntry;
+	}
+
+	return ableToSet;
+}
+
+/**
+ * @brief Visits the entries of the list in order in a single pass
+ *
+ * @details See LinkedList::traverse()
+ *
+ * @pre visit can be called as bool(const ItemType&)
+ *
+ * @post visit has been called on each entry until it returned false
+ *
+ * @par Algorithm
+ *      Follows the index links from the head
+ *
+ * @param[in] visit is called with each entry and returns false to stop early
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+template<class Visitor>
+void PooledList<ItemType> :: traverse(Visitor visit) const
+{
+	for (std::uint32_t currentIndex = headIndex;
+	     currentIndex != NO_NODE && visit(pool[currentIndex].item);
+	     currentIndex = pool[currentIndex].next)
+	{
+	}
+}
+
+/**
+ * @brief Reserves pool space for a number of entries
+ *
+ * @details Avoids regrowing the pool while the list is filled
+ *
+ * @pre none
+ *
+ * @post the pool can hold itemCapacity nodes without reallocating
+ *
+ * @par none
+ *
+ * @param[in] itemCapacity is the number of entries to make room for
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void PooledList<ItemType> :: reserve(int itemCapacity)
+{
+	if (itemCapacity > 0)
+	{
+		pool.reserve(static_cast<std::size_t>(itemCapacity));
+	}
+}
+
+/**
+ * @brief Gets the memory held by the list
+ *
+ * @details Counts the list object and the whole pool capacity, including free
+ *          and reserved nodes. The pool is one allocation, so there is no per
+ *          node allocator overhead to add. Heap memory owned by the entries
+ *          themselves, such as a std::string buffer, is not counted; free
+ *          nodes hold default constructed items that own none
+ *
+ * @pre none
+ *
+ * @post none
+ *
+ * @par none
+ *
+ * @return the footprint of the list in bytes
+ *
+ */
+template<class ItemType>
+std::size_t PooledList<ItemType> :: memoryUsage() const
+{
+	return sizeof(*this) + pool.capacity() * sizeof(PoolNode);
+}
+
+/**
+ * @brief Gets the pool index of the node at the given position
+ *
+ * @details none
+ *
+ * @pre Assumes that such position exists
+ *
+ * @post none
+ *
+ * @par Algorithm
+ *      Follows the index links from the head position - 1 times
+ *
+ * @param[in] position is where the node is at
+ *
+ * @return the pool index of the node
+ *
+ * @note uses the header cassert for debugging purposes
+ *
+ */
+template<class ItemType>
+std::uint32_t PooledList<ItemType> :: getNodeIndexAt(int position) const
+{
+	// Debuggin check of precondition
+	assert((position >= 1) && (position <= itemCount));
+
+	std::uint32_t currentIndex = headIndex;
+
+	for (int count = 1; count < position; count++)
+	{
+		currentIndex = pool[currentIndex].next;
+	}
+
+	return currentIndex;
+}
+
+#endif // end POOLED_LIST_CPP
@@ -0,0 +1,79 @@
+// Program Information /////////////////////////////////////////////////////
+/**
+ * @file PooledList.h
+ *
+ * @brief Header file for the pooled Linked List
+ *
+ * @details Singly linked list whose nodes live in one contiguous pool and are
+ *          linked by 32 bit indices instead of pointers. Each node is just the
+ *          item and a 4 byte link with no per node allocation, which is several
+ *          times smaller than a heap allocated Node for small item types.
+ *          Inherits ListInterface and StaticListInterface like LinkedList
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives ////////////////////////////////////////////////
+#ifndef POOLED_LIST_H
+#define POOLED_LIST_H
+
+// Header Files ///////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include "ListInterface.h"
+#include "StaticListInterface.h"
+#include "PrecondViolatedExcep.h"
+
+// Pooled List Templated Class Definition /////////////////////////////////
+template<class ItemType>
+class PooledList : public ListInterface<ItemType>,
+                   public StaticListInterface<PooledList<ItemType>, ItemType> {
+public:
+	PooledList();
+	virtual ~PooledList();
+
+	// functions for the list
+	bool isEmpty() const;
+	int getLength() const;
+	bool insert(int newPosition, const ItemType& newEntry);
+	bool remove(int position);
+	void clear();
+
+	// ItemType functions
+	ItemType getEntry(int position) const;
+	ItemType replace(int position, const ItemType& newEntry);
+
+	// non-throwing ItemType functions
+	bool tryGetEntry(int position, ItemType& entry) const
+		noexcept(std::is_nothrow_copy_assignable<ItemType>::value);
+	bool tryReplace(int position, const ItemType& newEntry)
+		noexcept(std::is_nothrow_copy_assignable<ItemType>::value);
+
+	// visits every entry in order in a single pass
+	template<class Visitor>
+	void traverse(Visitor visit) const;
+
+	// pool sizing and memory accounting
+	void reserve(int itemCapacity);
+	std::size_t memoryUsage() const;
+
+private:
+	struct PoolNode {
+		ItemType item;
+		std::uint32_t next;
+	};
+
+	static const std::uint32_t NO_NODE = 0xFFFFFFFFu;
+
+	std::vector<PoolNode> pool;
+	std::uint32_t headIndex;
+	std::uint32_t freeIndex;
+	int itemCount;
+
+	std::uint32_t getNodeIndexAt(int position) const;
+};
+
+#include "PooledList.cpp"
+#endif // end POOLED_LIST_H
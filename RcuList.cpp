@@ -0,0 +1,713 @@
+// Program Information //////////////////////////////////////////////////////////
+/**
+ * @file RcuList.cpp
+ *
+ * @brief Implementation file for the read-copy-update Linked List
+ *
+ * @details Implements all functions and methods defined by the RcuList class.
+ *
+ *          Memory ordering: the writer fills in a node before publishing it
+ *          with a release store, and readers follow links with acquire loads,
+ *          so a reader never sees a partly built node. A reader announces the
+ *          epoch it started in and then issues a full fence; the writer
+ *          advances the epoch and issues a full fence before it scans the
+ *          announcements. Either the writer sees the reader, or the reader
+ *          already sees the unlink, so a node is never freed under a reader.
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives /////////////////////////////////////////////////////
+#ifndef RCU_LIST_CPP
+#define RCU_LIST_CPP
+
+// Header Files ////////////////////////////////////////////////////////////////
+#include "RcuList.h"
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <thread>
+
+// Class/Data Structure member implementations /////////////////////////////////
+template<class ItemType>
+const unsigned long RcuList<ItemType> :: IDLE_EPOCH;
+
+template<class ItemType>
+const std::size_t RcuList<ItemType> :: RECLAIM_BATCH;
+
+/**
+ * @brief Parameterized constructor for an RCU node
+ *
+ * @details none
+ *
+ * @pre none
+ *
+ * @post Creates a node holding data and pointing at nextNodePtr
+ *
+ * @par Algorithm
+ *      Initializes all data members of the node
+ *
+ * @param[in] data is the item to store
+ *
+ * @param[in] nextNodePtr is the node that follows this one
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+RcuList<ItemType> :: RcuNode :: RcuNode(const ItemType& data, RcuNode* nextNodePtr)
+	: item(data), next(nextNodePtr)
+{
+}
+
+/**
+ * @brief RCU list constructor
+ *
+ * @details Creates an empty list and one idle slot per possible reader
+ *
+ * @pre none
+ *
+ * @post Initialized empty list at epoch 1 with maxReaders free reader slots,
+ *       each on its own cache line
+ *
+ * @par Algorithm
+ *      Allocates room for the slots plus one line of slack, constructs the
+ *      slots from the first line boundary and marks each one idle and free
+ *
+ * @param[in] maxReaders is the most reader threads registered at once
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+RcuList<ItemType> :: RcuList(int maxReaders)
+	: headPtr(nullptr), itemCount(0), globalEpoch(1), slotStorage(nullptr), readerSlots(nullptr),
+	  readerCapacity(maxReaders > 0 ? maxReaders : 1), reclaimThreshold(RECLAIM_BATCH)
+{
+	const std::size_t slotAlignment = alignof(ReaderSlot);
+
+	slotStorage = new char[readerCapacity * sizeof(ReaderSlot) + slotAlignment - 1];
+
+	std::uintptr_t address = reinterpret_cast<std::uintptr_t>(slotStorage);
+	address = (address + slotAlignment - 1) & ~static_cast<std::uintptr_t>(slotAlignment - 1);
+	readerSlots = reinterpret_cast<ReaderSlot*>(address);
+
+	for (int slot = 0; slot < readerCapacity; slot++)
+	{
+		new (&readerSlots[slot]) ReaderSlot;
+		readerSlots[slot].epoch.store(IDLE_EPOCH, std::memory_order_relaxed);
+		readerSlots[slot].registered.store(false, std::memory_order_relaxed);
+	}
+}
+
+/**
+ * @brief Destructor for the RCU list class
+ *
+ * @details Frees the chain, the retired nodes and the reader slots
+ *
+ * @pre No reader is inside a read side critical section
+ *
+ * @post All nodes are deallocated
+ *
+ * @par Algorithm
+ *      Retires the whole chain with clear(), then frees every retired node
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+RcuList<ItemType> :: ~RcuList()
+{
+	clear();
+
+	for (typename std::vector<RetiredNode>::size_type index = 0; index < retiredNodes.size(); index++)
+	{
+		delete retiredNodes[index].nodePtr;
+	}
+
+	for (int slot = 0; slot < readerCapacity; slot++)
+	{
+		readerSlots[slot].~ReaderSlot();
+	}
+
+	delete[] slotStorage;
+}
+
+/**
+ * @brief Registers the calling thread as a reader
+ *
+ * @details Call once per reader thread; claiming the slot is the only reader
+ *          side read-modify-write operation
+ *
+ * @pre none
+ *
+ * @post A free reader slot is reserved for the caller
+ *
+ * @par Algorithm
+ *      Claims the first slot whose registered flag can be switched from
+ *      false to true
+ *
+ * @return the reader id to pass to readLock() and readUnlock(), or -1 if
+ *         maxReaders readers are already registered
+ *
+ */
+template<class ItemType>
+int RcuList<ItemType> :: registerReader()
+{
+	for (int slot = 0; slot < readerCapacity; slot++)
+	{
+		bool expected = false;
+
+		if (readerSlots[slot].registered.compare_exchange_strong(expected, true))
+		{
+			return slot;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * @brief Releases a reader slot so another reader can register
+ *
+ * @details Call when a reader thread stops reading the list
+ *
+ * @pre the reader is not inside a critical section
+ *
+ * @post If the id is a registered, idle reader, its slot is free again
+ *
+ * @par none
+ *
+ * @param[in] readerId is the caller's reader id
+ *
+ * @return false if the id is not registered or is inside a critical section
+ *
+ */
+template<class ItemType>
+bool RcuList<ItemType> :: unregisterReader(int readerId)
+{
+	bool ableToUnregister = isReaderId(readerId)
+	    && readerSlots[readerId].epoch.load(std::memory_order_relaxed) == IDLE_EPOCH;
+
+	if (ableToUnregister)
+	{
+		readerSlots[readerId].registered.store(false, std::memory_order_release);
+	}
+
+	return ableToUnregister;
+}
+
+/**
+ * @brief Enters a read side critical section
+ *
+ * @details Nodes seen inside the section stay valid until readUnlock()
+ *
+ * @pre readerId came from registerReader() and the reader is not already inside
+ *
+ * @post the reader's start epoch is visible to the writer
+ *
+ * @par Algorithm
+ *      Announces the current global epoch in the reader slot, then issues a
+ *      full fence so the announcement is ordered before any chain load
+ *
+ * @param[in] readerId is the caller's reader id
+ *
+ * @return false, without entering, if the id is not a registered reader
+ *
+ */
+template<class ItemType>
+bool RcuList<ItemType> :: readLock(int readerId)
+{
+	if (!isReaderId(readerId))
+	{
+		return false;
+	}
+
+	readerSlots[readerId].epoch.store(globalEpoch.load(std::memory_order_acquire),
+	                                  std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	return true;
+}
+
+/**
+ * @brief Leaves a read side critical section
+ *
+ * @details Nodes seen inside the section must not be used afterwards
+ *
+ * @pre the reader is inside a critical section
+ *
+ * @post the reader no longer holds back reclamation
+ *
+ * @par Algorithm
+ *      Marks the reader slot idle with a release store so every read made in
+ *      the section happens before the writer frees the nodes
+ *
+ * @param[in] readerId is the caller's reader id
+ *
+ * @return false if the id is not a registered reader
+ *
+ */
+template<class ItemType>
+bool RcuList<ItemType> :: readUnlock(int readerId)
+{
+	if (!isReaderId(readerId))
+	{
+		return false;
+	}
+
+	readerSlots[readerId].epoch.store(IDLE_EPOCH, std::memory_order_release);
+
+	return true;
+}
+
+/**
+ * @brief Checks if the list is empty
+ *
+ * @details Safe to call from readers and the writer
+ *
+ * @pre none
+ *
+ * @post none
+ *
+ * @par none
+ *
+ * @return a boolean for an empty list at the time of the call
+ *
+ */
+template<class ItemType>
+bool RcuList<ItemType> :: isEmpty() const
+{
+	return headPtr.load(std::memory_order_acquire) == nullptr;
+}
+
+/**
+ * @brief Gets the length of the list
+ *
+ * @details Safe to call from readers and the writer. A reader may observe
+ *          the count and the chain at slightly different moments
+ *
+ * @pre none
+ *
+ * @post none
+ *
+ * @par none
+ *
+ * @return the number of items in the list
+ *
+ */
+template<class ItemType>
+int RcuList<ItemType> :: getLength() const
+{
+	return itemCount.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Gets the entry at some position without locking
+ *
+ * @details A concurrent writer may shift positions, so the entry is the one at
+ *          that position in some recent version of the list
+ *
+ * @pre called inside a read side critical section, or by the writer
+ *
+ * @post If the position is in the chain, entry holds a copy of its data
+ *
+ * @par Algorithm
+ *      Follows the links with acquire loads, stopping at the end of the chain
+ *
+ * @param[in] position is where the method will attempt to retrieve the data
+ *
+ * @param[out] entry receives the data at the given position
+ *
+ * @return a boolean logic if the entry was retrieved or not
+ *
+ */
+template<class ItemType>
+bool RcuList<ItemType> :: tryGetEntry(int position, ItemType& entry) const
+{
+	if (position < 1)
+	{
+		return false;
+	}
+
+	RcuNode* currentPtr = headPtr.load(std::memory_order_acquire);
+
+	for (int count = 1; count < position && currentPtr != nullptr; count++)
+	{
+		currentPtr = currentPtr->next.load(std::memory_order_acquire);
+	}
+
+	if (currentPtr == nullptr)
+	{
+		return false;
+	}
+
+	entry = currentPtr->item;
+	return true;
+}
+
+/**
+ * @brief Visits the entries of the list in order without locking
+ *
+ * @details See LinkedList::traverse()
+ *
+ * @pre called inside a read side critical section, or by the writer
+ *
+ * @post visit has been called on each entry until it returned false
+ *
+ * @par Algorithm
+ *      Follows the links with acquire loads from the head
+ *
+ * @param[in] visit is called with each entry and returns false to stop early
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+template<class Visitor>
+void RcuList<ItemType> :: traverse(Visitor visit) const
+{
+	for (RcuNode* currentPtr = headPtr.load(std::memory_order_acquire);
+	     currentPtr != nullptr && visit(static_cast<const ItemType&>(currentPtr->item));
+	     currentPtr = currentPtr->next.load(std::memory_order_acquire))
+	{
+	}
+}
+
+/**
+ * @brief Inserts a new node at some position
+ *
+ * @details Writer only
+ *
+ * @pre none
+ *
+ * @post If 1 <= newPosition <= getLength() + 1, newEntry is at that position
+ *
+ * @par Algorithm
+ *      Builds the node pointing at its successor, then publishes it with a
+ *      release store into the link before newPosition
+ *
+ * @param[in] newPosition is where the node will be inserted in this list
+ *
+ * @param[in] newEntry is the item to be inserted into the list
+ *
+ * @return a boolean logic if the insertion could be done or not
+ *
+ */
+template<class ItemType>
+bool RcuList<ItemType> :: insert(int newPosition, const ItemType& newEntry)
+{
+	int count = itemCount.load(std::memory_order_relaxed);
+	bool ableToInsert = (newPosition >= 1) && (newPosition <= count + 1);
+
+	if (ableToInsert)
+	{
+		std::atomic<RcuNode*>& link = getLinkBefore(newPosition);
+		RcuNode* newNodePtr = new RcuNode(newEntry, link.load(std::memory_order_relaxed));
+
+		link.store(newNodePtr, std::memory_order_release);
+		itemCount.store(count + 1, std::memory_order_release);
+	}
+
+	return ableToInsert;
+}
+
+/**
+ * @brief Removes the node at some position
+ *
+ * @details Writer only. The node is retired, not freed, so readers already
+ *          on it can finish
+ *
+ * @pre none
+ *
+ * @post If 1 <= position <= getLength(), the entry at that position is removed
+ *
+ * @par Algorithm
+ *      Publishes a link that skips the node with a release store, then
+ *      retires the node
+ *
+ * @param[in] position is where the node will be removed from
+ *
+ * @return A booleon for successful removal or not
+ *
+ */
+template<class ItemType>
+bool RcuList<ItemType> :: remove(int position)
+{
+	int count = itemCount.load(std::memory_order_relaxed);
+	bool ableToRemove = (position >= 1) && (position <= count);
+
+	if (ableToRemove)
+	{
+		std::atomic<RcuNode*>& link = getLinkBefore(position);
+		RcuNode* currentPtr = link.load(std::memory_order_relaxed);
+
+		link.store(currentPtr->next.load(std::memory_order_relaxed), std::memory_order_release);
+		itemCount.store(count - 1, std::memory_order_release);
+		retireNode(currentPtr);
+	}
+
+	return ableToRemove;
+}
+
+/**
+ * @brief Replaces the entry at some position
+ *
+ * @details Writer only. Readers may be copying the old item, so it is never
+ *          written in place: a copy of the node with the new item is published
+ *          instead and the old node is retired
+ *
+ * @pre none
+ *
+ * @post If 1 <= position <= getLength(), the entry at that position is newEntry
+ *
+ * @par Algorithm
+ *      Builds a replacement node pointing at the old node's successor,
+ *      publishes it with a release store and retires the old node
+ *
+ * @param[in] position is the location in the list for where the item is to be replaced
+ *
+ * @param[in] newEntry is the replacement item
+ *
+ * @return a boolean logic if the replacement could be done or not
+ *
+ */
+template<class ItemType>
+bool RcuList<ItemType> :: replace(int position, const ItemType& newEntry)
+{
+	bool ableToSet = (position >= 1) && (position <= itemCount.load(std::memory_order_relaxed));
+
+	if (ableToSet)
+	{
+		std::atomic<RcuNode*>& link = getLinkBefore(position);
+		RcuNode* oldNodePtr = link.load(std::memory_order_relaxed);
+		RcuNode* newNodePtr = new RcuNode(newEntry, oldNodePtr->next.load(std::memory_order_relaxed));
+
+		link.store(newNodePtr, std::memory_order_release);
+		retireNode(oldNodePtr);
+	}
+
+	return ableToSet;
+}
+
+/**
+ * @brief Clears the list
+ *
+ * @details Writer only. The old chain is retired as a whole
+ *
+ * @pre none
+ *
+ * @post the list is empty
+ *
+ * @par Algorithm
+ *      Publishes an empty head, then retires every node of the old chain
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void RcuList<ItemType> :: clear()
+{
+	RcuNode* currentPtr = headPtr.load(std::memory_order_relaxed);
+
+	headPtr.store(nullptr, std::memory_order_release);
+	itemCount.store(0, std::memory_order_release);
+
+	while (currentPtr != nullptr)
+	{
+		RcuNode* nextPtr = currentPtr->next.load(std::memory_order_relaxed);
+		retireNode(currentPtr);
+		currentPtr = nextPtr;
+	}
+}
+
+/**
+ * @brief Waits until every retired node has been freed
+ *
+ * @details Writer only. Blocks until every reader that was inside a critical
+ *          section when the call started has left it
+ *
+ * @pre the writer is not inside a read side critical section
+ *
+ * @post no retired nodes remain
+ *
+ * @par Algorithm
+ *      Reclaims repeatedly, yielding between attempts
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void RcuList<ItemType> :: synchronize()
+{
+	reclaim();
+
+	while (!retiredNodes.empty())
+	{
+		std::this_thread::yield();
+		reclaim();
+	}
+}
+
+/**
+ * @brief Gets the number of retired nodes that are not freed yet
+ *
+ * @details Writer only
+ *
+ * @return the number of nodes waiting for a grace period
+ *
+ */
+template<class ItemType>
+int RcuList<ItemType> :: getRetiredCount() const
+{
+	return static_cast<int>(retiredNodes.size());
+}
+
+/**
+ * @brief Checks that an id names a registered reader slot
+ *
+ * @details Checked in every build, so a failed registerReader() result of
+ *          -1 can never index the slot array
+ *
+ * @param[in] readerId is the id to check
+ *
+ * @return true if the id is in range and its slot is registered
+ *
+ */
+template<class ItemType>
+bool RcuList<ItemType> :: isReaderId(int readerId) const
+{
+	return (readerId >= 0) && (readerId < readerCapacity)
+	       && readerSlots[readerId].registered.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Gets the link that points at the node at the given position
+ *
+ * @details Writer only, so the walk can use relaxed loads
+ *
+ * @pre 1 <= position <= getLength() + 1
+ *
+ * @post none
+ *
+ * @par Algorithm
+ *      Returns the head for position 1, otherwise walks to the node before
+ *      the position and returns its next link
+ *
+ * @param[in] position is the position the link leads to
+ *
+ * @return a reference to the link
+ *
+ */
+template<class ItemType>
+std::atomic<typename RcuList<ItemType>::RcuNode*>& RcuList<ItemType> :: getLinkBefore(int position)
+{
+	if (position == 1)
+	{
+		return headPtr;
+	}
+
+	RcuNode* prevPtr = headPtr.load(std::memory_order_relaxed);
+
+	for (int count = 2; count < position; count++)
+	{
+		prevPtr = prevPtr->next.load(std::memory_order_relaxed);
+	}
+
+	return prevPtr->next;
+}
+
+/**
+ * @brief Retires an unlinked node until no reader can still see it
+ *
+ * @details Writer only. Reclaims once the backlog reaches the reclaim
+ *          threshold, which reclaim() sets to twice what it could not free.
+ *          A reader that holds back a grace period therefore costs the writer
+ *          amortized O(1) per retirement rather than a full scan each time
+ *
+ * @pre nodePtr is no longer reachable from the head
+ *
+ * @post the node is on the retired list tagged with the current epoch
+ *
+ * @par none
+ *
+ * @param[in] nodePtr is the node to retire
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void RcuList<ItemType> :: retireNode(RcuNode* nodePtr)
+{
+	RetiredNode retired = {nodePtr, globalEpoch.load(std::memory_order_relaxed)};
+	retiredNodes.push_back(retired);
+
+	if (retiredNodes.size() >= reclaimThreshold)
+	{
+		reclaim();
+	}
+}
+
+/**
+ * @brief Frees the retired nodes whose grace period has passed
+ *
+ * @details Writer only
+ *
+ * @pre none
+ *
+ * @post every retired node that no reader can still see is freed and the
+ *       reclaim threshold is twice the remaining backlog, at least RECLAIM_BATCH
+ *
+ * @par Algorithm
+ *      Advances the global epoch and issues a full fence, then finds the
+ *      oldest epoch announced by a reader inside a critical section. Nodes
+ *      retired before that epoch were unlinked before every active reader
+ *      started, so they are freed
+ *
+ * @return none
+ *
+ */
+template<class ItemType>
+void RcuList<ItemType> :: reclaim()
+{
+	unsigned long currentEpoch = globalEpoch.load(std::memory_order_relaxed);
+	globalEpoch.store(currentEpoch + 1, std::memory_order_release);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	// oldest epoch still held by a reader, or the new epoch if none is
+	unsigned long oldestEpoch = currentEpoch + 1;
+
+	for (int slot = 0; slot < readerCapacity; slot++)
+	{
+		unsigned long readerEpoch = readerSlots[slot].epoch.load(std::memory_order_acquire);
+
+		if (readerEpoch != IDLE_EPOCH && readerEpoch < oldestEpoch)
+		{
+			oldestEpoch = readerEpoch;
+		}
+	}
+
+	// free what is old enough and keep the rest in order
+	typename std::vector<RetiredNode>::size_type keptCount = 0;
+
+	for (typename std::vector<RetiredNode>::size_type index = 0; index < retiredNodes.size(); index++)
+	{
+		if (retiredNodes[index].epoch < oldestEpoch)
+		{
+			delete retiredNodes[index].nodePtr;
+		}
+
+		else
+		{
+			retiredNodes[keptCount] = retiredNodes[index];
+			keptCount++;
+		}
+	}
+
+	retiredNodes.resize(keptCount);
+
+	// wait for the backlog to double before scanning again
+	reclaimThreshold = std::max(RECLAIM_BATCH, 2 * keptCount);
+}
+
+#endif // end RCU_LIST_CPP
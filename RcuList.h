@@ -0,0 +1,103 @@
+// Program Information /////////////////////////////////////////////////////
+/**
+ * @file RcuList.h
+ *
+ * @brief Header file for the read-copy-update Linked List
+ *
+ * @details Read mostly singly linked list for one writer thread and many
+ *          reader threads. Readers traverse without locks and without atomic
+ *          read-modify-write operations; the writer publishes every link
+ *          change with release semantics. Unlinked nodes are retired and only
+ *          freed after every reader that could still see them has left its
+ *          read side critical section (epoch based reclamation).
+ *
+ *          Reader threads call registerReader() once, then bracket each scan
+ *          with readLock() and readUnlock(), and call unregisterReader() when
+ *          they are done so the slot can be reused. All writer functions must
+ *          be called from the same single thread.
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives ////////////////////////////////////////////////
+#ifndef RCU_LIST_H
+#define RCU_LIST_H
+
+// Header Files ///////////////////////////////////////////////////////////
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// RCU List Templated Class Definition ////////////////////////////////////
+template<class ItemType>
+class RcuList {
+public:
+	RcuList(int maxReaders = 64);
+	virtual ~RcuList();
+
+	// reader registration and read side critical sections
+	int registerReader();
+	bool unregisterReader(int readerId);
+	bool readLock(int readerId);
+	bool readUnlock(int readerId);
+
+	// reader functions, call between readLock() and readUnlock()
+	bool isEmpty() const;
+	int getLength() const;
+	bool tryGetEntry(int position, ItemType& entry) const;
+	template<class Visitor>
+	void traverse(Visitor visit) const;
+
+	// writer functions, single writer thread only
+	bool insert(int newPosition, const ItemType& newEntry);
+	bool remove(int position);
+	bool replace(int position, const ItemType& newEntry);
+	void clear();
+	void synchronize();
+	int getRetiredCount() const;
+
+private:
+	struct RcuNode {
+		RcuNode(const ItemType& data, RcuNode* nextNodePtr);
+
+		ItemType item;
+		std::atomic<RcuNode*> next;
+	};
+
+	struct RetiredNode {
+		RcuNode* nodePtr;
+		unsigned long epoch;
+	};
+
+	// one cache line per reader so readers do not share lines; new[] does
+	// not honour this alignment before C++17, so the slot array is placed
+	// on a line boundary by hand
+	struct alignas(64) ReaderSlot {
+		std::atomic<unsigned long> epoch;
+		std::atomic<bool> registered;
+	};
+
+	static const unsigned long IDLE_EPOCH = 0;
+	static const std::size_t RECLAIM_BATCH = 32;
+
+	std::atomic<RcuNode*> headPtr;
+	std::atomic<int> itemCount;
+	std::atomic<unsigned long> globalEpoch;
+	char* slotStorage;
+	ReaderSlot* readerSlots;
+	int readerCapacity;
+	std::vector<RetiredNode> retiredNodes;
+	std::size_t reclaimThreshold;
+
+	bool isReaderId(int readerId) const;
+	std::atomic<RcuNode*>& getLinkBefore(int position);
+	void retireNode(RcuNode* nodePtr);
+	void reclaim();
+
+	// readers hold raw pointers into the chain, so copying is not allowed
+	RcuList(const RcuList<ItemType>& otherList) = delete;
+	RcuList<ItemType>& operator=(const RcuList<ItemType>& otherList) = delete;
+};
+
+#include "RcuList.cpp"
+#endif // end RCU_LIST_H
@@ -0,0 +1,177 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file RcuListBenchmark.cpp
+ *
+ * @brief Reader throughput of the read-copy-update list against write rate
+ *
+ * @details Runs a fixed number of reader threads scanning the list for a fixed
+ *          time while one writer edits it at increasing target rates, from no
+ *          writes up to an unthrottled writer. Readers take no locks, so their
+ *          scan rate should stay close to flat as the write rate rises; the
+ *          remaining drop comes from cache misses on nodes the writer replaced.
+ *          Prints one row per rate with the achieved writes and the reader
+ *          scans per second
+ *
+ * @version 1.00
+ */
+
+// Header Files ////////////////////////////////////////////////////////////////
+#include "RcuList.h"
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Benchmark constants /////////////////////////////////////////////////////////
+static const int READER_THREADS = 4;
+static const int LIST_LENGTH = 1000;
+static const int RUN_MILLISECONDS = 1000;
+static const long UNTHROTTLED = 0;
+
+// Benchmark types /////////////////////////////////////////////////////////////
+struct BenchmarkRow {
+	long writesPerSecond;
+	long scansPerSecond;
+};
+
+// Benchmark functions /////////////////////////////////////////////////////////
+/**
+ * @brief Measures reader scans while the writer runs at one target rate
+ *
+ * @details The writer performs a replace at a cycling position, paced to the
+ *          target rate by sleeping until each write is due
+ *
+ * @param[in] targetWriteRate is the writes per second to aim for, -1 for no
+ *            writer, or UNTHROTTLED for a writer that never sleeps
+ *
+ * @return the achieved write and scan rates
+ *
+ */
+static BenchmarkRow runAtWriteRate(long targetWriteRate)
+{
+	typedef std::chrono::steady_clock Clock;
+
+	RcuList<long> list(READER_THREADS);
+	std::atomic<bool> stop(false);
+	std::atomic<long> scanCount(0);
+	std::vector<std::thread> readers;
+	long writeCount = 0;
+
+	for (int position = 1; position <= LIST_LENGTH; position++)
+	{
+		list.insert(position, position);
+	}
+
+	for (int thread = 0; thread < READER_THREADS; thread++)
+	{
+		readers.push_back(std::thread([&]()
+		{
+			int readerId = list.registerReader();
+			long scans = 0;
+			long sum = 0;
+
+			while (!stop.load(std::memory_order_relaxed))
+			{
+				list.readLock(readerId);
+
+				list.traverse([&](const long& entry) -> bool
+				{
+					sum += entry;
+					return true;
+				});
+
+				list.readUnlock(readerId);
+				scans++;
+			}
+
+			// keep the scan from being optimized away
+			scanCount += scans + (sum == -1 ? 1 : 0);
+			list.unregisterReader(readerId);
+		}));
+	}
+
+	Clock::time_point start = Clock::now();
+	Clock::time_point finish = start + std::chrono::milliseconds(RUN_MILLISECONDS);
+
+	while (Clock::now() < finish)
+	{
+		if (targetWriteRate < 0)
+		{
+			std::this_thread::sleep_until(finish);
+			break;
+		}
+
+		if (targetWriteRate != UNTHROTTLED)
+		{
+			Clock::time_point due = start + std::chrono::microseconds(writeCount * 1000000 / targetWriteRate);
+			std::this_thread::sleep_until(due);
+		}
+
+		list.replace(static_cast<int>(writeCount % LIST_LENGTH) + 1, writeCount);
+		writeCount++;
+	}
+
+	stop.store(true);
+
+	for (std::vector<std::thread>::size_type thread = 0; thread < readers.size(); thread++)
+	{
+		readers[thread].join();
+	}
+
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	BenchmarkRow row;
+	row.writesPerSecond = static_cast<long>(writeCount / seconds);
+	row.scansPerSecond = static_cast<long>(scanCount.load() / seconds);
+
+	return row;
+}
+
+// Main program ////////////////////////////////////////////////////////////////
+int main()
+{
+	const long targetRates[] = { -1, 1000, 10000, 100000, UNTHROTTLED };
+	const int rateCount = sizeof(targetRates) / sizeof(targetRates[0]);
+	long baselineScans = 0;
+
+	std::cout << READER_THREADS << " readers, " << LIST_LENGTH << " entries, "
+	          << RUN_MILLISECONDS << " ms per rate" << std::endl;
+	std::cout << std::setw(14) << "target w/s" << std::setw(14) << "actual w/s"
+	          << std::setw(16) << "scans/s" << std::setw(12) << "vs idle" << std::endl;
+
+	for (int rate = 0; rate < rateCount; rate++)
+	{
+		BenchmarkRow row = runAtWriteRate(targetRates[rate]);
+
+		if (rate == 0)
+		{
+			baselineScans = row.scansPerSecond;
+		}
+
+		std::cout << std::setw(14);
+
+		if (targetRates[rate] < 0)
+		{
+			std::cout << "none";
+		}
+
+		else if (targetRates[rate] == UNTHROTTLED)
+		{
+			std::cout << "unthrottled";
+		}
+
+		else
+		{
+			std::cout << targetRates[rate];
+		}
+
+		std::cout << std::setw(14) << row.writesPerSecond
+		          << std::setw(16) << row.scansPerSecond
+		          << std::setw(11) << std::fixed << std::setprecision(1)
+		          << (baselineScans > 0 ? 100.0 * row.scansPerSecond / baselineScans : 0.0)
+		          << "%" << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,178 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file RcuListStressTest.cpp
+ *
+ * @brief Stress test for the read-copy-update list
+ *
+ * @details Reader threads scan the list while one writer inserts, removes
+ *          and replaces entries. Every entry is a string of a single repeated
+ *          letter whose length is recorded in its first character, so a reader
+ *          that sees a freed or half built node finds a malformed entry.
+ *          Readers also unregister and register again while the writer runs,
+ *          more times than there are reader slots, to check slot reuse.
+ *          Intended to run under -fsanitize=thread or -fsanitize=address
+ *
+ * @version 1.00
+ */
+
+// Header Files ////////////////////////////////////////////////////////////////
+#include "RcuList.h"
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test constants //////////////////////////////////////////////////////////////
+static const int READER_THREADS = 4;
+static const int MAX_READERS = 4;
+static const int INITIAL_LENGTH = 64;
+static const int WRITER_ROUNDS = 50000;
+static const int SCANS_PER_REGISTRATION = 100;
+
+// Test helper functions ///////////////////////////////////////////////////////
+/**
+ * @brief Builds a self describing entry
+ *
+ * @details The first character encodes the length, the rest is one letter
+ *
+ * @param[in] length is the total length, from 2 to 60
+ *
+ * @param[in] letter is the fill letter
+ *
+ * @return the entry
+ *
+ */
+static std::string makeEntry(int length, char letter)
+{
+	std::string entry(length, letter);
+	entry[0] = static_cast<char>('A' + length);
+	return entry;
+}
+
+/**
+ * @brief Checks that an entry is one makeEntry() could have built
+ *
+ * @param[in] entry is the entry to check
+ *
+ * @return true if the length and fill letters are consistent
+ *
+ */
+static bool isWellFormed(const std::string& entry)
+{
+	if (entry.size() < 2 || entry[0] != static_cast<char>('A' + entry.size()))
+	{
+		return false;
+	}
+
+	for (std::string::size_type index = 2; index < entry.size(); index++)
+	{
+		if (entry[index] != entry[1])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Main program ////////////////////////////////////////////////////////////////
+int main()
+{
+	RcuList<std::string> list(MAX_READERS);
+	std::atomic<bool> stop(false);
+	std::atomic<long> scanCount(0);
+	std::atomic<long> registrationCount(0);
+	std::atomic<int> failureCount(0);
+	std::vector<std::thread> readers;
+
+	for (int position = 1; position <= INITIAL_LENGTH; position++)
+	{
+		list.insert(position, makeEntry(2 + position % 40, 'a'));
+	}
+
+	// a failed registration must be rejected, never index the slot array
+	if (list.readLock(-1) || list.readUnlock(MAX_READERS) || list.unregisterReader(0))
+	{
+		failureCount++;
+	}
+
+	for (int thread = 0; thread < READER_THREADS; thread++)
+	{
+		readers.push_back(std::thread([&]()
+		{
+			while (!stop.load())
+			{
+				int readerId = list.registerReader();
+
+				if (readerId < 0)
+				{
+					failureCount++;
+					return;
+				}
+
+				registrationCount++;
+
+				for (int scan = 0; scan < SCANS_PER_REGISTRATION && !stop.load(); scan++)
+				{
+					std::string entry;
+
+					list.readLock(readerId);
+
+					list.traverse([&](const std::string& scanned) -> bool
+					{
+						if (!isWellFormed(scanned))
+						{
+							failureCount++;
+						}
+
+						return true;
+					});
+
+					if (list.tryGetEntry(INITIAL_LENGTH / 2, entry) && !isWellFormed(entry))
+					{
+						failureCount++;
+					}
+
+					list.readUnlock(readerId);
+					scanCount++;
+				}
+
+				if (!list.unregisterReader(readerId))
+				{
+					failureCount++;
+				}
+			}
+		}));
+	}
+
+	for (int round = 0; round < WRITER_ROUNDS; round++)
+	{
+		int position = round % (INITIAL_LENGTH - 8) + 1;
+
+		list.remove(position);
+		list.insert(position, makeEntry(2 + round % 50, static_cast<char>('b' + round % 20)));
+		list.replace(round % INITIAL_LENGTH + 1, makeEntry(2 + round % 58, 'x'));
+	}
+
+	stop.store(true);
+
+	for (std::vector<std::thread>::size_type thread = 0; thread < readers.size(); thread++)
+	{
+		readers[thread].join();
+	}
+
+	list.synchronize();
+
+	if (list.getRetiredCount() != 0 || list.getLength() != INITIAL_LENGTH)
+	{
+		failureCount++;
+	}
+
+	std::cout << "scans: " << scanCount.load()
+	          << ", registrations: " << registrationCount.load()
+	          << ", failures: " << failureCount.load() << std::endl;
+
+	return (failureCount.load() == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,201 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file StaticDispatchBenchmark.cpp
+ *
+ * @brief Compares generic algorithms through the virtual and static interfaces
+ *
+ * @details Runs the same two algorithms, counting the even entries and summing
+ *          all entries, in the ways generic code can reach a list:
+ *
+ *          - a getEntry() loop through ListInterface&, one virtual call and
+ *            one walk from the head per entry
+ *          - the same getEntry() loop through StaticListInterface, which
+ *            removes the virtual call but keeps the walk
+ *          - countIf() and foldList() through StaticListInterface, a single
+ *            inlined traverse() pass
+ *
+ *          each on a LinkedList and on a PooledList. Prints microseconds per
+ *          pass over the whole list
+ *
+ * @version 1.00
+ */
+
+// Header Files ////////////////////////////////////////////////////////////////
+#include "LinkedList.h"
+#include "PooledList.h"
+#include "ListAlgorithms.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// Benchmark constants /////////////////////////////////////////////////////////
+static const int LIST_LENGTH = 2000;
+static const int POSITIONAL_PASSES = 20;
+static const int TRAVERSE_PASSES = 20000;
+
+// Benchmark functions /////////////////////////////////////////////////////////
+/**
+ * @brief Counts and sums by position through the virtual interface
+ *
+ * @param[in] list is the list to examine
+ *
+ * @param[out] evenCount receives the number of even entries
+ *
+ * @return the sum of the entries
+ *
+ */
+static long sumByPosition(const ListInterface<long>& list, int& evenCount)
+{
+	long sum = 0;
+	evenCount = 0;
+
+	for (int position = 1; position <= list.getLength(); position++)
+	{
+		long entry = list.getEntry(position);
+		evenCount += (entry % 2 == 0) ? 1 : 0;
+		sum += entry;
+	}
+
+	return sum;
+}
+
+/**
+ * @brief Counts and sums by position through the static interface
+ *
+ * @param[in] list is the list to examine
+ *
+ * @param[out] evenCount receives the number of even entries
+ *
+ * @return the sum of the entries
+ *
+ */
+template<class Derived>
+long sumByPosition(const StaticListInterface<Derived, long>& list, int& evenCount)
+{
+	long sum = 0;
+	evenCount = 0;
+
+	for (int position = 1; position <= list.getLength(); position++)
+	{
+		long entry = list.getEntry(position);
+		evenCount += (entry % 2 == 0) ? 1 : 0;
+		sum += entry;
+	}
+
+	return sum;
+}
+
+/**
+ * @brief Counts and sums with the traverse based algorithms
+ *
+ * @param[in] list is the list to examine
+ *
+ * @param[out] evenCount receives the number of even entries
+ *
+ * @return the sum of the entries
+ *
+ */
+template<class Derived>
+long sumByTraversal(const StaticListInterface<Derived, long>& list, int& evenCount)
+{
+	evenCount = countIf(list, [](const long& entry) { return entry % 2 == 0; });
+	return foldList(list, 0L, [](long sum, const long& entry) { return sum + entry; });
+}
+
+/**
+ * @brief Times one way of running the algorithms and prints it as a row
+ *
+ * @param[in] name is what was timed
+ *
+ * @param[in] passes is how many times to run the algorithms
+ *
+ * @param[in] runPass runs the algorithms once and returns a checksum
+ *
+ * @return none
+ *
+ */
+template<class Pass>
+void timePasses(const std::string& name, int passes, Pass runPass)
+{
+	typedef std::chrono::steady_clock Clock;
+
+	long checksum = 0;
+	Clock::time_point start = Clock::now();
+
+	for (int pass = 0; pass < passes; pass++)
+	{
+		checksum += runPass();
+	}
+
+	double microseconds = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+	std::cout << "  " << std::left << std::setw(40) << name << std::right
+	          << std::setw(12) << std::fixed << std::setprecision(2)
+	          << microseconds / passes << " us/pass"
+	          << "   (checksum " << checksum / passes << ")" << std::endl;
+}
+
+// Main program ////////////////////////////////////////////////////////////////
+int main()
+{
+	LinkedList<long> linkedList;
+	PooledList<long> pooledList;
+
+	for (int position = 1; position <= LIST_LENGTH; position++)
+	{
+		linkedList.insert(position, position);
+		pooledList.insert(position, position);
+	}
+
+	// reached through a pointer table, as code holding ListInterface& would be
+	ListInterface<long>* virtualLists[] = { &linkedList, &pooledList };
+	const std::string listNames[] = { "LinkedList", "PooledList" };
+
+	std::cout << LIST_LENGTH << " entries, count evens and sum" << std::endl;
+
+	for (int list = 0; list < 2; list++)
+	{
+		const ListInterface<long>& virtualList = *virtualLists[list];
+
+		std::cout << listNames[list] << std::endl;
+
+		timePasses("getEntry loop, ListInterface&", POSITIONAL_PASSES, [&]() -> long
+		{
+			int evenCount = 0;
+			return sumByPosition(virtualList, evenCount) + evenCount;
+		});
+
+		if (list == 0)
+		{
+			timePasses("getEntry loop, StaticListInterface", POSITIONAL_PASSES, [&]() -> long
+			{
+				int evenCount = 0;
+				return sumByPosition(linkedList, evenCount) + evenCount;
+			});
+
+			timePasses("countIf + foldList, StaticListInterface", TRAVERSE_PASSES, [&]() -> long
+			{
+				int evenCount = 0;
+				return sumByTraversal(linkedList, evenCount) + evenCount;
+			});
+		}
+
+		else
+		{
+			timePasses("getEntry loop, StaticListInterface", POSITIONAL_PASSES, [&]() -> long
+			{
+				int evenCount = 0;
+				return sumByPosition(pooledList, evenCount) + evenCount;
+			});
+
+			timePasses("countIf + foldList, StaticListInterface", TRAVERSE_PASSES, [&]() -> long
+			{
+				int evenCount = 0;
+				return sumByTraversal(pooledList, evenCount) + evenCount;
+			});
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file StaticListInterface.h
+ *
+ * @brief Compile time interface file for the List ADT
+ *
+ * @details Specifies the same contract as ListInterface, but as a CRTP base
+ *          so that generic code written against it is resolved at compile
+ *          time and can be inlined. A list class derives from both
+ *          ListInterface<ItemType> and
+ *          StaticListInterface<ListClass, ItemType>; the virtual interface
+ *          stays available for runtime polymorphism.
+ *
+ *          Every call forwards to the derived class with a qualified name, so
+ *          it is never dispatched through the vtable even when the derived
+ *          functions are virtual.
+ *
+ * @version 1.00
+ */
+
+#ifndef _STATIC_LIST_INTERFACE
+#define _STATIC_LIST_INTERFACE
+
+template<class Derived, class ItemType>
+class StaticListInterface
+{
+public:
+	/** Sees whether this list is empty.
+	@return True if the list is empty; otherwise returns false. */
+	bool isEmpty() const
+	{
+		return derived().Derived::isEmpty();
+	}
+
+	/** Gets the current number of entries in this list.
+	@return The integer number of entries currently in the list. */
+	int getLength() const
+	{
+		return derived().Derived::getLength();
+	}
+
+	/** Inserts an entry into this list at a given position.
+	@see ListInterface::insert */
+	bool insert(int newPosition, const ItemType& newEntry)
+	{
+		return derived().Derived::insert(newPosition, newEntry);
+	}
+
+	/** Removes the entry at a given position from this list.
+	@see ListInterface::remove */
+	bool remove(int position)
+	{
+		return derived().Derived::remove(position);
+	}
+
+	/** Removes all entries from this list.
+	@post  List contains no entries and the count of items is 0. */
+	void clear()
+	{
+		derived().Derived::clear();
+	}
+
+	/** Gets the entry at the given position in this list.
+	@see ListInterface::getEntry */
+	ItemType getEntry(int position) const
+	{
+		return derived().Derived::getEntry(position);
+	}
+
+	/** Replaces the entry at the given position in this list.
+	@see ListInterface::replace */
+	ItemType replace(int position, const ItemType& newEntry)
+	{
+		return derived().Derived::replace(position, newEntry);
+	}
+
+	/** Visits the entries of this list in order, front to back.
+	@pre  visit can be called as bool(const ItemType&).
+	@post  visit has been called on each entry until it returned false.
+	@param visit  Called on each entry; returns false to stop early. */
+	template<class Visitor>
+	void traverse(Visitor visit) const
+	{
+		derived().Derived::traverse(visit);
+	}
+
+	/** Gets the list this interface belongs to.
+	@return  The derived list object. */
+	Derived& derived()
+	{
+		return static_cast<Derived&>(*this);
+	}
+
+	/** Gets the list this interface belongs to.
+	@return  The derived list object. */
+	const Derived& derived() const
+	{
+		return static_cast<const Derived&>(*this);
+	}
+
+protected:
+	/** Only derived lists can be destroyed; this is not a polymorphic base. */
+	~StaticListInterface() {}
+}; // end StaticListInterface
+#endif
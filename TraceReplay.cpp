@@ -0,0 +1,131 @@
+// Program Information //////////////////////////////////////////////////////////
+/**
+ * @file TraceReplay.cpp
+ *
+ * @brief Implementation file for the trace replay harness
+ *
+ * @details Operations are replayed back to back as fast as possible; the
+ *          timestamps in the trace are not used for pacing
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives /////////////////////////////////////////////////////
+#ifndef TRACE_REPLAY_CPP
+#define TRACE_REPLAY_CPP
+
+// Header Files ////////////////////////////////////////////////////////////////
+#include "TraceReplay.h"
+#include "PrecondViolatedExcep.h"
+#include <chrono>
+
+// Trace replay implementations ////////////////////////////////////////////////
+/**
+ * @brief Replays a trace with default constructed items
+ *
+ * @details see the three argument replayTrace()
+ *
+ * @param[in] trace is the trace to replay
+ *
+ * @param[in] list is the list to replay it against
+ *
+ * @return the throughput and latency report of the replay
+ *
+ */
+template<class ItemType>
+ReplayReport replayTrace(const ListTrace& trace, ListInterface<ItemType>& list)
+{
+	return replayTrace(trace, list, [](std::uint32_t) { return ItemType(); });
+}
+
+/**
+ * @brief Replays a trace against a list and measures every operation
+ *
+ * @details Positions the list rejects, by returning false or throwing
+ *          PrecondViolatedExcept, are counted as failed operations
+ *
+ * @pre list is in the state the trace was captured from, usually empty
+ *
+ * @post every operation of the trace has been applied to list
+ *
+ * @par Algorithm
+ *      Times each operation with a steady clock and collects the latencies
+ *      into a ReplayReport. The clock reads add a few tens of nanoseconds to
+ *      each latency, the same for every list
+ *
+ * @param[in] trace is the trace to replay
+ *
+ * @param[in] list is the list to replay it against
+ *
+ * @param[in] makeItem builds the item for an insert or replace from its
+ *            recorded payload size, as ItemType(std::uint32_t)
+ *
+ * @return the throughput and latency report of the replay
+ *
+ */
+template<class ItemType, class ItemFactory>
+ReplayReport replayTrace(const ListTrace& trace, ListInterface<ItemType>& list, ItemFactory makeItem)
+{
+	typedef std::chrono::steady_clock Clock;
+
+	std::vector<std::uint64_t> latencies;
+	latencies.reserve(trace.getLength());
+	int failedOps = 0;
+	Clock::time_point replayStart = Clock::now();
+
+	for (int index = 1; index <= trace.getLength(); index++)
+	{
+		const ListTraceRecord& record = trace.getRecord(index);
+		ItemType item = (record.op == TRACE_INSERT || record.op == TRACE_REPLACE)
+		                ? makeItem(record.payloadSize) : ItemType();
+		bool succeeded = true;
+		Clock::time_point opStart = Clock::now();
+
+		try
+		{
+			switch (record.op)
+			{
+				case TRACE_INSERT:
+					succeeded = list.insert(record.position, item);
+					break;
+
+				case TRACE_REMOVE:
+					succeeded = list.remove(record.position);
+					break;
+
+				case TRACE_GET_ENTRY:
+					item = list.getEntry(record.position);
+					break;
+
+				case TRACE_REPLACE:
+					list.replace(record.position, item);
+					break;
+
+				default:
+					list.clear();
+					break;
+			}
+		}
+
+		catch (const PrecondViolatedExcept&)
+		{
+			succeeded = false;
+		}
+
+		Clock::time_point opEnd = Clock::now();
+		latencies.push_back(static_cast<std::uint64_t>(
+			std::chrono::duration_cast<std::chrono::nanoseconds>(opEnd - opStart).count()));
+
+		if (!succeeded)
+		{
+			failedOps++;
+		}
+	}
+
+	std::uint64_t elapsed = static_cast<std::uint64_t>(
+		std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - replayStart).count());
+
+	return ReplayReport(latencies, elapsed, failedOps);
+}
+
+#endif // end TRACE_REPLAY_CPP
@@ -0,0 +1,30 @@
+// Program Information /////////////////////////////////////////////////////
+/**
+ * @file TraceReplay.h
+ *
+ * @brief Header file for the trace replay harness
+ *
+ * @details Runs a captured ListTrace against a list and reports throughput
+ *          and latency percentiles, so list implementations can be compared
+ *          on production operation mixes
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives ////////////////////////////////////////////////
+#ifndef TRACE_REPLAY_H
+#define TRACE_REPLAY_H
+
+// Header Files ///////////////////////////////////////////////////////////
+#include "ListInterface.h"
+#include "ListTrace.h"
+
+// Trace replay declarations //////////////////////////////////////////////
+template<class ItemType>
+ReplayReport replayTrace(const ListTrace& trace, ListInterface<ItemType>& list);
+
+template<class ItemType, class ItemFactory>
+ReplayReport replayTrace(const ListTrace& trace, ListInterface<ItemType>& list, ItemFactory makeItem);
+
+#include "TraceReplay.cpp"
+#endif // end TRACE_REPLAY_H
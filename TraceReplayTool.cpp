@@ -0,0 +1,113 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file TraceReplayTool.cpp
+ *
+ * @brief Replays a saved list trace against every list implementation
+ *
+ * @details Loads a trace written by ListTrace::save(), for example one
+ *          captured in production with TracingList, and replays it with
+ *          replayTrace() against an empty LinkedList, PooledList and
+ *          AdaptiveList, printing the throughput and latency report of each.
+ *          Inserted and replacing items are strings as long as the recorded
+ *          payload size, so traces captured with a real size functor replay
+ *          with real sizes
+ *
+ *          Usage: TraceReplayTool <trace file>
+ *
+ * @version 1.00
+ */
+
+// Header Files ////////////////////////////////////////////////////////////////
+#include "AdaptiveList.h"
+#include "LinkedList.h"
+#include "PooledList.h"
+#include "ListTrace.h"
+#include "TraceReplay.h"
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Tool functions //////////////////////////////////////////////////////////////
+/**
+ * @brief Builds a replayed item from its recorded payload size
+ *
+ * @param[in] payloadSize is the size recorded in the trace
+ *
+ * @return a string of that many characters
+ *
+ */
+static std::string makeItem(std::uint32_t payloadSize)
+{
+	return std::string(payloadSize, 'x');
+}
+
+/**
+ * @brief Replays the trace against one list and prints its report
+ *
+ * @param[in] listName is the name printed before the report
+ *
+ * @param[in] trace is the trace to replay
+ *
+ * @param[in] list is the empty list to replay it against
+ *
+ * @return none
+ *
+ */
+static void replayAndPrint(const std::string& listName, const ListTrace& trace,
+                           ListInterface<std::string>& list)
+{
+	std::cout << listName << ": ";
+	replayTrace(trace, list, makeItem).print(std::cout);
+}
+
+// Main program ////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+	if (argc != 2)
+	{
+		std::cerr << "usage: " << argv[0] << " <trace file>" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::ifstream traceFile(argv[1], std::ios::binary);
+
+	if (!traceFile)
+	{
+		std::cerr << argv[1] << ": cannot open the trace file" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	ListTrace trace;
+
+	if (!trace.load(traceFile))
+	{
+		std::cerr << argv[1] << ": not a valid list trace (bad header, unsupported"
+		          << " version, truncated or corrupt record)" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << argv[1] << ": " << trace.getLength() << " records" << std::endl;
+
+	try
+	{
+		LinkedList<std::string> linkedList;
+		PooledList<std::string> pooledList;
+		AdaptiveList<std::string> adaptiveList;
+
+		replayAndPrint("LinkedList", trace, linkedList);
+		replayAndPrint("PooledList", trace, pooledList);
+		replayAndPrint("AdaptiveList", trace, adaptiveList);
+	}
+
+	catch (const std::exception& error)
+	{
+		// e.g. a payload size too large to allocate
+		std::cerr << argv[1] << ": replay failed: " << error.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
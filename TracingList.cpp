@@ -0,0 +1,212 @@
+// Program Information //////////////////////////////////////////////////////////
+/**
+ * @file TracingList.cpp
+ *
+ * @brief Implementation file for the tracing list wrapper
+ *
+ * @details Implements all functions and methods defined by the TracingList
+ *          class. Operations are recorded before they are forwarded, so
+ *          rejected and throwing operations are part of the trace too
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives /////////////////////////////////////////////////////
+#ifndef TRACING_LIST_CPP
+#define TRACING_LIST_CPP
+
+// Header Files ////////////////////////////////////////////////////////////////
+#include "TracingList.h"
+
+// Class/Data Structure member implementations /////////////////////////////////
+/**
+ * @brief Tracing list constructor
+ *
+ * @details Timestamps in the trace are measured from this point
+ *
+ * @pre tracedList and targetTrace outlive the wrapper
+ *
+ * @post Operations on the wrapper go to tracedList and are recorded in targetTrace
+ *
+ * @par Algorithm
+ *      Initializes the references, the payload size functor and the start time
+ *
+ * @param[in] tracedList is the list to forward operations to
+ *
+ * @param[in] targetTrace is the trace to append records to
+ *
+ * @param[in] itemPayloadSize gives the payload size recorded for an item, as
+ *            std::uint32_t(const ItemType&)
+ *
+ * @return none
+ *
+ */
+template<class ItemType, class PayloadSize>
+TracingList<ItemType, PayloadSize> :: TracingList(ListInterface<ItemType>& tracedList, ListTrace& targetTrace,
+                                               PayloadSize itemPayloadSize)
+	: list(tracedList), trace(targetTrace), startTime(std::chrono::steady_clock::now()),
+	  payloadSizeOf(itemPayloadSize)
+{
+}
+
+/**
+ * @brief Destructor for the tracing list class
+ *
+ * @details The wrapped list and the trace are not owned and are left intact
+ *
+ * @return none
+ *
+ */
+template<class ItemType, class PayloadSize>
+TracingList<ItemType, PayloadSize> :: ~TracingList()
+{
+}
+
+/**
+ * @brief Checks if the wrapped list is empty
+ *
+ * @details Not recorded
+ *
+ * @return a boolean for an empty list
+ *
+ */
+template<class ItemType, class PayloadSize>
+bool TracingList<ItemType, PayloadSize> :: isEmpty() const
+{
+	return list.isEmpty();
+}
+
+/**
+ * @brief Gets the length of the wrapped list
+ *
+ * @details Not recorded
+ *
+ * @return the number of items in the list
+ *
+ */
+template<class ItemType, class PayloadSize>
+int TracingList<ItemType, PayloadSize> :: getLength() const
+{
+	return list.getLength();
+}
+
+/**
+ * @brief Records and forwards an insertion
+ *
+ * @details The record carries the payload size of newEntry
+ *
+ * @param[in] newPosition is where the node will be inserted in the list
+ *
+ * @param[in] newEntry is the item to be inserted into the list
+ *
+ * @return the result of the wrapped list's insert()
+ *
+ */
+template<class ItemType, class PayloadSize>
+bool TracingList<ItemType, PayloadSize> :: insert(int newPosition, const ItemType& newEntry)
+{
+	record(TRACE_INSERT, newPosition, payloadSizeOf(newEntry));
+	return list.insert(newPosition, newEntry);
+}
+
+/**
+ * @brief Records and forwards a removal
+ *
+ * @param[in] position is where the node will be removed from
+ *
+ * @return the result of the wrapped list's remove()
+ *
+ */
+template<class ItemType, class PayloadSize>
+bool TracingList<ItemType, PayloadSize> :: remove(int position)
+{
+	record(TRACE_REMOVE, position, 0);
+	return list.remove(position);
+}
+
+/**
+ * @brief Records and forwards a clear
+ *
+ * @return none
+ *
+ */
+template<class ItemType, class PayloadSize>
+void TracingList<ItemType, PayloadSize> :: clear()
+{
+	record(TRACE_CLEAR, 0, 0);
+	list.clear();
+}
+
+/**
+ * @brief Records and forwards a lookup
+ *
+ * @exception whatever the wrapped list's getEntry() throws
+ *
+ * @param[in] position is where the method will attempt to retrieve the data
+ *
+ * @return the result of the wrapped list's getEntry()
+ *
+ */
+template<class ItemType, class PayloadSize>
+ItemType TracingList<ItemType, PayloadSize> :: getEntry(int position) const
+{
+	record(TRACE_GET_ENTRY, position, 0);
+	return list.getEntry(position);
+}
+
+/**
+ * @brief Records and forwards a replacement
+ *
+ * @details The record carries the payload size of newEntry
+ *
+ * @exception whatever the wrapped list's replace() throws
+ *
+ * @param[in] position is the location in the list for where the item is to be replaced
+ *
+ * @param[in] newEntry is the replacement item
+ *
+ * @return the result of the wrapped list's replace()
+ *
+ */
+template<class ItemType, class PayloadSize>
+ItemType TracingList<ItemType, PayloadSize> :: replace(int position, const ItemType& newEntry)
+{
+	record(TRACE_REPLACE, position, payloadSizeOf(newEntry));
+	return list.replace(position, newEntry);
+}
+
+/**
+ * @brief Appends one record to the trace
+ *
+ * @details none
+ *
+ * @pre none
+ *
+ * @post the trace ends with a record of the operation, stamped with the time
+ *       since the wrapper was created
+ *
+ * @par none
+ *
+ * @param[in] op is the operation being made
+ *
+ * @param[in] position is the position passed to the operation
+ *
+ * @param[in] payloadSize is the size of the item passed to the operation
+ *
+ * @return none
+ *
+ */
+template<class ItemType, class PayloadSize>
+void TracingList<ItemType, PayloadSize> :: record(ListTraceOp op, int position, std::uint32_t payloadSize) const
+{
+	ListTraceRecord newRecord;
+	newRecord.timestamp = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - startTime).count());
+	newRecord.position = position;
+	newRecord.payloadSize = payloadSize;
+	newRecord.op = static_cast<std::uint8_t>(op);
+
+	trace.addRecord(newRecord);
+}
+
+#endif // end TRACING_LIST_CPP
@@ -0,0 +1,71 @@
+// Program Information /////////////////////////////////////////////////////
+/**
+ * @file TracingList.h
+ *
+ * @brief Header file for the tracing list wrapper
+ *
+ * @details Opt-in wrapper around any ListInterface implementation. Every
+ *          insert, remove, getEntry, replace and clear is forwarded to the
+ *          wrapped list and recorded in a ListTrace, which can be saved and
+ *          replayed later with replayTrace(). Inserts and replaces record
+ *          the size of their item as given by the PayloadSize functor, which
+ *          defaults to sizeof(ItemType); pass one that measures the item,
+ *          such as a string's length, so traces of variable size items carry
+ *          the real sizes for replayTrace()'s item factory
+ *
+ * @version 1.00
+ */
+
+// Pre compiler directives ////////////////////////////////////////////////
+#ifndef TRACING_LIST_H
+#define TRACING_LIST_H
+
+// Header Files ///////////////////////////////////////////////////////////
+#include <chrono>
+#include <cstdint>
+#include "ListInterface.h"
+#include "ListTrace.h"
+
+// Default payload size, the fixed size of the item type
+template<class ItemType>
+struct ItemSize {
+	std::uint32_t operator()(const ItemType&) const
+	{
+		return static_cast<std::uint32_t>(sizeof(ItemType));
+	}
+};
+
+// Tracing List Templated Class Definition ////////////////////////////////
+template<class ItemType, class PayloadSize = ItemSize<ItemType> >
+class TracingList : public ListInterface<ItemType> {
+public:
+	TracingList(ListInterface<ItemType>& tracedList, ListTrace& targetTrace,
+	            PayloadSize itemPayloadSize = PayloadSize());
+	virtual ~TracingList();
+
+	// functions for the list
+	bool isEmpty() const;
+	int getLength() const;
+	bool insert(int newPosition, const ItemType& newEntry);
+	bool remove(int position);
+	void clear();
+
+	// ItemType functions
+	ItemType getEntry(int position) const;
+	ItemType replace(int position, const ItemType& newEntry);
+
+private:
+	ListInterface<ItemType>& list;
+	ListTrace& trace;
+	std::chrono::steady_clock::time_point startTime;
+	PayloadSize payloadSizeOf;
+
+	void record(ListTraceOp op, int position, std::uint32_t payloadSize) const;
+
+	// the wrapper only refers to its list and trace, so copying is not allowed
+	TracingList(const TracingList& otherList) = delete;
+	TracingList& operator=(const TracingList& otherList) = delete;
+};
+
+#include "TracingList.cpp"
+#endif // end TRACING_LIST_H
@@ -0,0 +1,144 @@
+// Program Information /////////////////////////////////////////////////////////
+/**
+ * @file TryAccessBenchmark.cpp
+ *
+ * @brief Compares the throwing and non-throwing LinkedList accessors
+ *
+ * @details Times out-of-range probes made with getEntry() inside try/catch
+ *          against the same probes made with tryGetEntry(), then times
+ *          in-range reads with getEntry(), tryGetEntry() and operator[].
+ *          The list is kept short so the walk to the position does not hide
+ *          the cost of the access itself. Prints nanoseconds per operation
+ *
+ * @version 1.00
+ */
+
+// Header Files ////////////////////////////////////////////////////////////////
+#include "LinkedList.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// Benchmark constants /////////////////////////////////////////////////////////
+static const int LIST_LENGTH = 16;
+static const int OUT_OF_RANGE_PROBES = 200000;
+static const int IN_RANGE_READS = 5000000;
+
+// Benchmark functions /////////////////////////////////////////////////////////
+/**
+ * @brief Prints one timed run as a table row
+ *
+ * @param[in] name is what was timed
+ *
+ * @param[in] elapsed is how long the run took
+ *
+ * @param[in] operations is how many operations the run made
+ *
+ * @param[in] checksum is a value derived from the results, printed so the
+ *            work cannot be optimized away
+ *
+ * @return none
+ *
+ */
+static void printRow(const std::string& name, std::chrono::steady_clock::duration elapsed,
+                     int operations, long checksum)
+{
+	double nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count();
+
+	std::cout << "  " << std::left << std::setw(34) << name << std::right
+	          << std::setw(10) << std::fixed << std::setprecision(1)
+	          << nanoseconds / operations << " ns/op"
+	          << "   (checksum " << checksum << ")" << std::endl;
+}
+
+// Main program ////////////////////////////////////////////////////////////////
+int main()
+{
+	typedef std::chrono::steady_clock Clock;
+
+	LinkedList<long> list;
+	long checksum = 0;
+	Clock::time_point start;
+
+	for (int position = 1; position <= LIST_LENGTH; position++)
+	{
+		list.insert(position, position);
+	}
+
+	std::cout << LIST_LENGTH << " entries" << std::endl;
+	std::cout << "out-of-range probes" << std::endl;
+
+	start = Clock::now();
+
+	for (int probe = 0; probe < OUT_OF_RANGE_PROBES; probe++)
+	{
+		try
+		{
+			checksum += list.getEntry(LIST_LENGTH + 1 + probe % 4);
+		}
+
+		catch (const PrecondViolatedExcept&)
+		{
+			checksum--;
+		}
+	}
+
+	printRow("getEntry with try/catch", Clock::now() - start, OUT_OF_RANGE_PROBES, checksum);
+
+	checksum = 0;
+	start = Clock::now();
+
+	for (int probe = 0; probe < OUT_OF_RANGE_PROBES; probe++)
+	{
+		long entry = 0;
+
+		if (list.tryGetEntry(LIST_LENGTH + 1 + probe % 4, entry))
+		{
+			checksum += entry;
+		}
+
+		else
+		{
+			checksum--;
+		}
+	}
+
+	printRow("tryGetEntry", Clock::now() - start, OUT_OF_RANGE_PROBES, checksum);
+
+	std::cout << "in-range reads" << std::endl;
+
+	checksum = 0;
+	start = Clock::now();
+
+	for (int read = 0; read < IN_RANGE_READS; read++)
+	{
+		checksum += list.getEntry(read % LIST_LENGTH + 1);
+	}
+
+	printRow("getEntry", Clock::now() - start, IN_RANGE_READS, checksum);
+
+	checksum = 0;
+	start = Clock::now();
+
+	for (int read = 0; read < IN_RANGE_READS; read++)
+	{
+		long entry = 0;
+		list.tryGetEntry(read % LIST_LENGTH + 1, entry);
+		checksum += entry;
+	}
+
+	printRow("tryGetEntry", Clock::now() - start, IN_RANGE_READS, checksum);
+
+	checksum = 0;
+	start = Clock::now();
+
+	for (int read = 0; read < IN_RANGE_READS; read++)
+	{
+		checksum += list[read % LIST_LENGTH + 1];
+	}
+
+	printRow("operator[]", Clock::now() - start, IN_RANGE_READS, checksum);
+
+	return 0;
+}